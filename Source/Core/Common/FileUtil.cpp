@@ -357,6 +357,37 @@ u64 GetSize(const std::string& path)
   return FileInfo(path).GetSize();
 }
 
+SizeAndModificationTime GetSizeAndModificationTime(const std::string& path)
+{
+#ifdef ANDROID
+  if (IsPathAndroidContent(path))
+    return {GetSize(path), 0};
+#endif
+
+#ifdef _WIN32
+  WIN32_FILE_ATTRIBUTE_DATA attributes;
+  if (!GetFileAttributesExW(UTF8ToWString(path).c_str(), GetFileExInfoStandard, &attributes) ||
+      (attributes.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+  {
+    return {};
+  }
+  return {(u64(attributes.nFileSizeHigh) << 32) | attributes.nFileSizeLow,
+          (u64(attributes.ftLastWriteTime.dwHighDateTime) << 32) |
+              attributes.ftLastWriteTime.dwLowDateTime};
+#else
+  struct stat file_info;
+  if (stat(path.c_str(), &file_info) != 0 || S_ISDIR(file_info.st_mode))
+    return {};
+#ifdef __APPLE__
+  const timespec& time = file_info.st_mtimespec;
+#else
+  const timespec& time = file_info.st_mtim;
+#endif
+  return {static_cast<u64>(file_info.st_size),
+          static_cast<u64>(time.tv_sec) * 1000000000 + static_cast<u64>(time.tv_nsec)};
+#endif
+}
+
 // Overloaded GetSize, accepts FILE*
 u64 GetSize(FILE* f)
 {
@@ -148,6 +148,17 @@ bool IsFile(const std::string& path);
 // Returns the size of a file (or returns 0 if the path isn't a file that exists)
 u64 GetSize(const std::string& path);
 
+struct SizeAndModificationTime
+{
+  u64 size = 0;
+  // In an unspecified epoch and resolution that only suits comparisons with earlier results
+  u64 modification_time = 0;
+};
+
+// Returns the size of a file and the time at which it was last modified, using a single query of
+// the file system (or returns zeros for what can't be determined)
+SizeAndModificationTime GetSizeAndModificationTime(const std::string& path);
+
 // Overloaded GetSize, accepts FILE*
 u64 GetSize(FILE* f);
 
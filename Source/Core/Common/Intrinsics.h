@@ -7,7 +7,7 @@
 
 /**
  * It is assumed that all compilers used to build Dolphin support intrinsics up to and including
- * SSE 4.2 on x86/x64.
+ * AVX2 on x86/x64.
  */
 
 #if defined(__GNUC__) || defined(__clang__)
@@ -27,6 +27,9 @@
  */
 
 #include <x86intrin.h>
+#ifndef __AVX2__
+#define FUNCTION_TARGET_AVX2 [[gnu::target("avx2")]]
+#endif
 #ifndef __SSE4_2__
 #define FUNCTION_TARGET_SSE42 [[gnu::target("sse4.2")]]
 #endif
@@ -57,6 +60,9 @@
  * version without the macro around a #ifdef guard. Be careful when using intrinsics, as all use
  * should still be placed around a #ifdef _M_X86_64 if the file is compiled on all architectures.
  */
+#ifndef FUNCTION_TARGET_AVX2
+#define FUNCTION_TARGET_AVX2
+#endif
 #ifndef FUNCTION_TARGET_SSE42
 #define FUNCTION_TARGET_SSE42
 #endif
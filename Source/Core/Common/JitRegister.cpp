@@ -7,6 +7,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <fstream>
+#include <mutex>
 #include <string>
 
 #include <fmt/format.h>
@@ -21,6 +22,12 @@
 #include <unistd.h>
 #endif
 
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+
 #if defined USE_OPROFILE && USE_OPROFILE
 #include <opagent.h>
 #endif
@@ -40,7 +47,135 @@ namespace Common::JitRegister
 {
 static bool s_is_enabled = false;
 
-void Init(const std::string& perf_dir)
+#ifdef __linux__
+// See tools/perf/Documentation/jitdump-specification.txt in the Linux source tree.
+namespace
+{
+constexpr u32 JITDUMP_MAGIC = 0x4A695444;  // JiTD
+constexpr u32 JITDUMP_VERSION = 1;
+constexpr u32 JIT_CODE_LOAD = 0;
+constexpr u32 JIT_CODE_CLOSE = 3;
+
+#if defined(_M_X86_64)
+constexpr u32 JITDUMP_ELF_MACH = 62;  // EM_X86_64
+#elif defined(_M_ARM_64)
+constexpr u32 JITDUMP_ELF_MACH = 183;  // EM_AARCH64
+#else
+constexpr u32 JITDUMP_ELF_MACH = 0;
+#endif
+
+struct JitDumpHeader
+{
+  u32 magic;
+  u32 version;
+  u32 total_size;
+  u32 elf_mach;
+  u32 pad1;
+  u32 pid;
+  u64 timestamp;
+  u64 flags;
+};
+
+struct JitDumpRecordHeader
+{
+  u32 id;
+  u32 total_size;
+  u64 timestamp;
+};
+
+struct JitDumpCodeLoad
+{
+  JitDumpRecordHeader header;
+  u32 pid;
+  u32 tid;
+  u64 vma;
+  u64 code_addr;
+  u64 code_size;
+  u64 code_index;
+};
+
+// Code is registered by the CPU thread, the GPU thread and the vertex loader precompile worker.
+// Each record has to be written in one piece, so the file and the code index are only used while
+// this is held.
+std::mutex s_jitdump_mutex;
+File::IOFile s_jitdump_file;
+void* s_jitdump_marker = nullptr;
+long s_jitdump_marker_size = 0;
+u64 s_jitdump_code_index = 0;
+
+// perf expects the timestamps to come from the clock passed to `perf record -k`.
+u64 GetJitDumpTimestamp()
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<u64>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+void OpenJitDump(const std::string& dir)
+{
+  const std::string filename = fmt::format("{}/jit-{}.dump", dir, getpid());
+  if (!s_jitdump_file.Open(filename, "wb+"))
+    return;
+
+  const JitDumpHeader header{JITDUMP_MAGIC, JITDUMP_VERSION, sizeof(JitDumpHeader),
+                             JITDUMP_ELF_MACH, 0, static_cast<u32>(getpid()),
+                             GetJitDumpTimestamp(), 0};
+  if (!s_jitdump_file.WriteBytes(&header, sizeof(header)))
+  {
+    s_jitdump_file.Close();
+    return;
+  }
+
+  // perf record only picks up the file if it sees an executable mapping of it.
+  s_jitdump_marker_size = sysconf(_SC_PAGESIZE);
+  s_jitdump_marker = mmap(nullptr, s_jitdump_marker_size, PROT_READ | PROT_EXEC, MAP_PRIVATE,
+                          fileno(s_jitdump_file.GetHandle()), 0);
+  if (s_jitdump_marker == MAP_FAILED)
+    s_jitdump_marker = nullptr;
+}
+
+void CloseJitDump()
+{
+  std::lock_guard lk(s_jitdump_mutex);
+  if (!s_jitdump_file.IsOpen())
+    return;
+
+  const JitDumpRecordHeader record{JIT_CODE_CLOSE, sizeof(JitDumpRecordHeader),
+                                   GetJitDumpTimestamp()};
+  s_jitdump_file.WriteBytes(&record, sizeof(record));
+
+  if (s_jitdump_marker)
+    munmap(s_jitdump_marker, s_jitdump_marker_size);
+  s_jitdump_marker = nullptr;
+  s_jitdump_file.Close();
+}
+
+void WriteJitDumpCodeLoad(const void* base_address, u32 code_size, const std::string& symbol_name)
+{
+  const u32 name_size = static_cast<u32>(symbol_name.size() + 1);
+
+  std::lock_guard lk(s_jitdump_mutex);
+  if (!s_jitdump_file.IsOpen())
+    return;
+
+  const JitDumpCodeLoad record{
+      {JIT_CODE_LOAD, static_cast<u32>(sizeof(JitDumpCodeLoad) + name_size + code_size),
+       GetJitDumpTimestamp()},
+      static_cast<u32>(getpid()),
+      static_cast<u32>(syscall(SYS_gettid)),
+      reinterpret_cast<u64>(base_address),
+      reinterpret_cast<u64>(base_address),
+      code_size,
+      s_jitdump_code_index++,
+  };
+  s_jitdump_file.WriteBytes(&record, sizeof(record));
+  s_jitdump_file.WriteBytes(symbol_name.c_str(), name_size);
+  s_jitdump_file.WriteBytes(base_address, code_size);
+}
+}  // namespace
+#endif
+
+void Init(const std::string& perf_dir, bool write_jitdump)
 {
 #if defined USE_OPROFILE && USE_OPROFILE
   s_agent = op_open_agent();
@@ -57,6 +192,15 @@ void Init(const std::string& perf_dir)
     std::setvbuf(s_perf_map_file.GetHandle(), nullptr, _IONBF, 0);
     s_is_enabled = true;
   }
+
+#ifdef __linux__
+  if (write_jitdump)
+  {
+    OpenJitDump(perf_dir.empty() ? "/tmp" : perf_dir);
+    if (s_jitdump_file.IsOpen())
+      s_is_enabled = true;
+  }
+#endif
 }
 
 void Shutdown()
@@ -73,6 +217,10 @@ void Shutdown()
   if (s_perf_map_file.IsOpen())
     s_perf_map_file.Close();
 
+#ifdef __linux__
+  CloseJitDump();
+#endif
+
   s_is_enabled = false;
 }
 
@@ -84,7 +232,7 @@ bool IsEnabled()
 void Register(const void* base_address, u32 code_size, const std::string& symbol_name)
 {
 #if !(defined USE_OPROFILE && USE_OPROFILE) && !defined(USE_VTUNE)
-  if (!s_perf_map_file.IsOpen())
+  if (!s_is_enabled)
     return;
 #endif
 
@@ -101,6 +249,11 @@ void Register(const void* base_address, u32 code_size, const std::string& symbol
   iJIT_NotifyEvent(iJVM_EVENT_TYPE_METHOD_LOAD_FINISHED, (void*)&jmethod);
 #endif
 
+#ifdef __linux__
+  // Linux perf jit-$pid.dump:
+  WriteJitDumpCodeLoad(base_address, code_size, symbol_name);
+#endif
+
   // Linux perf /tmp/perf-$pid.map:
   if (!s_perf_map_file.IsOpen())
     return;
@@ -11,7 +11,9 @@
 
 namespace Common::JitRegister
 {
-void Init(const std::string& perf_dir);
+// Writes a perf map to perf_dir if it is set. If write_jitdump is set, a jitdump file including
+// the generated code is written to the same directory, for use with `perf inject --jit`.
+void Init(const std::string& perf_dir, bool write_jitdump);
 void Shutdown();
 void Register(const void* base_address, u32 code_size, const std::string& symbol_name);
 bool IsEnabled();
@@ -102,10 +102,11 @@ public:
   /// from.
   /// @param size Size of the region to map.
   /// @param base Address within the memory region from ReserveMemoryRegion() where to map it.
+  /// @param writeable Whether the mapping can be written to. Writing to a read-only mapping faults.
   ///
   /// @return The address we actually ended up mapping, which should be the given 'base'.
   ///
-  void* MapInMemoryRegion(s64 offset, size_t size, void* base);
+  void* MapInMemoryRegion(s64 offset, size_t size, void* base, bool writeable = true);
 
   ///
   /// Unmap a memory region previously mapped with MapInMemoryRegion().
@@ -24,7 +24,7 @@ void MemArena::GrabSHMSegment(size_t size, std::string_view base_name)
   }
 
   memory_object_size_t entry_size = size;
-  constexpr vm_prot_t prot = VM_PROT_READ | VM_PROT_WRITE;
+  const vm_prot_t prot = writeable ? VM_PROT_READ | VM_PROT_WRITE : VM_PROT_READ;
 
   retval = mach_make_memory_entry_64(mach_task_self(), &entry_size, m_shm_address, prot,
                                      &m_shm_entry, MACH_PORT_NULL);
@@ -121,7 +121,7 @@ void MemArena::ReleaseMemoryRegion()
   m_region_size = 0;
 }
 
-void* MemArena::MapInMemoryRegion(s64 offset, size_t size, void* base)
+void* MemArena::MapInMemoryRegion(s64 offset, size_t size, void* base, bool writeable)
 {
   if (m_shm_address == 0)
   {
@@ -318,7 +318,7 @@ WindowsMemoryRegion* MemArena::EnsureSplitRegionForMapping(void* start_address,
   }
 }
 
-void* MemArena::MapInMemoryRegion(s64 offset, size_t size, void* base)
+void* MemArena::MapInMemoryRegion(s64 offset, size_t size, void* base, bool writeable)
 {
   if (m_memory_functions.m_api_ms_win_core_memory_l1_1_6_handle.IsOpen())
   {
@@ -330,8 +330,8 @@ void* MemArena::MapInMemoryRegion(s64 offset, size_t size, void* base)
     }
 
     void* rv = static_cast<PMapViewOfFile3>(m_memory_functions.m_address_MapViewOfFile3)(
-        m_memory_handle, nullptr, base, offset, size, MEM_REPLACE_PLACEHOLDER, PAGE_READWRITE,
-        nullptr, 0);
+        m_memory_handle, nullptr, base, offset, size, MEM_REPLACE_PLACEHOLDER,
+        writeable ? PAGE_READWRITE : PAGE_READONLY, nullptr, 0);
     if (rv)
     {
       region->m_is_mapped = true;
@@ -346,7 +346,8 @@ void* MemArena::MapInMemoryRegion(s64 offset, size_t size, void* base)
     return rv;
   }
 
-  return MapViewOfFileEx(m_memory_handle, FILE_MAP_ALL_ACCESS, 0, (DWORD)((u64)offset), size, base);
+  return MapViewOfFileEx(m_memory_handle, writeable ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ, 0,
+                         (DWORD)((u64)offset), size, base);
 }
 
 bool MemArena::JoinRegionsAfterUnmap(void* start_address, size_t size)
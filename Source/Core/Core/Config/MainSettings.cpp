@@ -39,8 +39,13 @@ const Info<bool> MAIN_SKIP_IPL{{System::Main, "Core", "SkipIPL"}, true};
 const Info<PowerPC::CPUCore> MAIN_CPU_CORE{{System::Main, "Core", "CPUCore"},
                                            PowerPC::DefaultCPUCore()};
 const Info<bool> MAIN_JIT_FOLLOW_BRANCH{{System::Main, "Core", "JITFollowBranch"}, true};
+const Info<bool> MAIN_JIT_SUPERBLOCKS{{System::Main, "Core", "JITSuperblocks"}, false};
+const Info<bool> MAIN_JIT_WARM_START{{System::Main, "Core", "JITWarmStart"}, false};
+const Info<bool> MAIN_JIT_INTERPRET_COLD_BLOCKS{{System::Main, "Core", "JITInterpretColdBlocks"},
+                                                false};
 const Info<bool> MAIN_FASTMEM{{System::Main, "Core", "Fastmem"}, true};
 const Info<bool> MAIN_FASTMEM_ARENA{{System::Main, "Core", "FastmemArena"}, true};
+const Info<bool> MAIN_FASTMEM_PAGE_TABLE{{System::Main, "Core", "FastmemPageTable"}, false};
 const Info<bool> MAIN_LARGE_ENTRY_POINTS_MAP{{System::Main, "Core", "LargeEntryPointsMap"}, true};
 const Info<bool> MAIN_ACCURATE_CPU_CACHE{{System::Main, "Core", "AccurateCPUCache"}, false};
 const Info<bool> MAIN_DSP_HLE{{System::Main, "Core", "DSPHLE"}, true};
@@ -261,6 +266,7 @@ GPUDeterminismMode GetGPUDeterminismMode()
 }
 
 const Info<std::string> MAIN_PERF_MAP_DIR{{System::Main, "Core", "PerfMapDir"}, ""};
+const Info<bool> MAIN_PERF_JITDUMP{{System::Main, "Core", "PerfJitDump"}, false};
 const Info<bool> MAIN_CUSTOM_RTC_ENABLE{{System::Main, "Core", "EnableCustomRTC"}, false};
 // Measured in seconds since the unix epoch (1.1.1970).  Default is 1.1.2000; there are 7 leap years
 // between those dates.
@@ -542,6 +548,8 @@ const Info<bool> MAIN_DEBUG_JIT_REGISTER_CACHE_OFF{{System::Main, "Debug", "JitR
                                                    false};
 const Info<bool> MAIN_DEBUG_JIT_ENABLE_PROFILING{{System::Main, "Debug", "JitEnableProfiling"},
                                                  false};
+const Info<bool> MAIN_DEBUG_JIT_WRITE_FUNCTION_PROFILE{
+    {System::Main, "Debug", "JitWriteFunctionProfile"}, false};
 
 // Main.BluetoothPassthrough
 
@@ -55,8 +55,12 @@ namespace Config
 extern const Info<bool> MAIN_SKIP_IPL;
 extern const Info<PowerPC::CPUCore> MAIN_CPU_CORE;
 extern const Info<bool> MAIN_JIT_FOLLOW_BRANCH;
+extern const Info<bool> MAIN_JIT_SUPERBLOCKS;
+extern const Info<bool> MAIN_JIT_WARM_START;
+extern const Info<bool> MAIN_JIT_INTERPRET_COLD_BLOCKS;
 extern const Info<bool> MAIN_FASTMEM;
 extern const Info<bool> MAIN_FASTMEM_ARENA;
+extern const Info<bool> MAIN_FASTMEM_PAGE_TABLE;
 extern const Info<bool> MAIN_LARGE_ENTRY_POINTS_MAP;
 extern const Info<bool> MAIN_ACCURATE_CPU_CACHE;
 // Should really be in the DSP section, but we're kind of stuck with bad decisions made in the past.
@@ -154,6 +158,7 @@ extern const Info<std::string> MAIN_GPU_DETERMINISM_MODE;
 GPUDeterminismMode GetGPUDeterminismMode();
 
 extern const Info<std::string> MAIN_PERF_MAP_DIR;
+extern const Info<bool> MAIN_PERF_JITDUMP;
 extern const Info<bool> MAIN_CUSTOM_RTC_ENABLE;
 extern const Info<u32> MAIN_CUSTOM_RTC_VALUE;
 extern const Info<bool> MAIN_AUTO_DISC_CHANGE;
@@ -349,6 +354,9 @@ extern const Info<bool> MAIN_DEBUG_JIT_SYSTEM_REGISTERS_OFF;
 extern const Info<bool> MAIN_DEBUG_JIT_BRANCH_OFF;
 extern const Info<bool> MAIN_DEBUG_JIT_REGISTER_CACHE_OFF;
 extern const Info<bool> MAIN_DEBUG_JIT_ENABLE_PROFILING;
+// When emulation stops, writes the block profiling data summed up per guest function to a CSV file.
+// Only has an effect while JitEnableProfiling is set.
+extern const Info<bool> MAIN_DEBUG_JIT_WRITE_FUNCTION_PROFILE;
 
 // Main.BluetoothPassthrough
 
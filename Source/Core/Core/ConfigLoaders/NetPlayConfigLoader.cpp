@@ -88,6 +88,7 @@ public:
     layer->Set(Config::MAIN_SYNC_GPU_OVERCLOCK, m_settings.sync_gpu_overclock);
 
     layer->Set(Config::MAIN_JIT_FOLLOW_BRANCH, m_settings.jit_follow_branch);
+    layer->Set(Config::MAIN_JIT_SUPERBLOCKS, m_settings.jit_superblocks);
     layer->Set(Config::MAIN_FAST_DISC_SPEED, m_settings.fast_disc_speed);
     layer->Set(Config::MAIN_MMU, m_settings.mmu);
     layer->Set(Config::MAIN_FASTMEM, m_settings.fastmem);
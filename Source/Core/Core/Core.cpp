@@ -67,6 +67,7 @@
 #include "Core/PatchEngine.h"
 #include "Core/PowerPC/GDBStub.h"
 #include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/State.h"
 #include "Core/System.h"
@@ -151,6 +152,9 @@ void FrameUpdateOnCPUThread()
 
 void OnFrameEnd(Core::System& system)
 {
+  system.GetJitInterface().OnFrameEnd();
+  system.GetMMU().OnFrameEnd();
+
 #ifdef USE_MEMORYWATCHER
   if (s_memory_watcher)
   {
@@ -4,6 +4,7 @@
 #include "Core/CoreTiming.h"
 
 #include <algorithm>
+#include <bit>
 #include <mutex>
 #include <string>
 #include <unordered_map>
@@ -38,6 +39,145 @@ static void EmptyTimedCallback(Core::System& system, u64 userdata, s64 cyclesLat
 {
 }
 
+const Event& EventQueue::Top() const
+{
+  if (m_wheel_size == 0)
+    return m_far_events.front();
+  return *FindEarliestInWheel();
+}
+
+Event EventQueue::Pop()
+{
+  Event event;
+  if (m_wheel_size == 0)
+  {
+    event = m_far_events.front();
+    std::ranges::pop_heap(m_far_events, std::ranges::greater{});
+    m_far_events.pop_back();
+  }
+  else
+  {
+    const u32 index = GetIndex(*GetFirstOccupiedSlot());
+    std::vector<Event>& slot = m_slots[index];
+    const auto it = std::ranges::min_element(slot);
+    event = *it;
+    *it = slot.back();
+    slot.pop_back();
+    if (slot.empty())
+      m_occupied[index / 64] &= ~(u64(1) << (index % 64));
+    --m_wheel_size;
+  }
+
+  --m_size;
+  Settle();
+  return event;
+}
+
+void EventQueue::Push(const Event& event)
+{
+  ++m_size;
+
+  // Start the wheel at the earliest event so that as many events as possible fit in it.
+  if (m_wheel_size == 0)
+  {
+    const s64 slot = GetSlot(event.time);
+    Rebase(m_far_events.empty() ? slot : std::min(slot, GetSlot(m_far_events.front().time)));
+  }
+
+  if (GetSlot(event.time) >= m_base_slot + NUM_SLOTS)
+  {
+    m_far_events.push_back(event);
+    std::ranges::push_heap(m_far_events, std::ranges::greater{});
+    return;
+  }
+
+  InsertIntoWheel(event);
+}
+
+void EventQueue::Clear()
+{
+  for (u32 i = 0; i < NUM_SLOTS; ++i)
+    m_slots[i].clear();
+  m_occupied.fill(0);
+  m_far_events.clear();
+  m_wheel_size = 0;
+  m_size = 0;
+}
+
+std::vector<Event> EventQueue::GetSortedEvents() const
+{
+  std::vector<Event> events;
+  events.reserve(m_size);
+  for (const std::vector<Event>& slot : m_slots)
+    events.insert(events.end(), slot.begin(), slot.end());
+  events.insert(events.end(), m_far_events.begin(), m_far_events.end());
+  std::ranges::sort(events);
+  return events;
+}
+
+const Event* EventQueue::FindEarliestInWheel() const
+{
+  const std::vector<Event>& slot = m_slots[GetIndex(*GetFirstOccupiedSlot())];
+  return &*std::ranges::min_element(slot);
+}
+
+std::optional<s64> EventQueue::GetFirstOccupiedSlot() const
+{
+  if (m_wheel_size == 0)
+    return std::nullopt;
+
+  // Scan the bitmap starting at the slot m_base_slot maps to, wrapping around at the end.
+  constexpr u32 NUM_WORDS = NUM_SLOTS / 64;
+  const u32 base_index = GetIndex(m_base_slot);
+  const u32 first_word = base_index / 64;
+  const u32 shift = base_index % 64;
+
+  u64 bits = m_occupied[first_word] >> shift;
+  if (bits != 0)
+    return m_base_slot + std::countr_zero(bits);
+
+  for (u32 i = 1; i <= NUM_WORDS; ++i)
+  {
+    bits = m_occupied[(first_word + i) % NUM_WORDS];
+    // After wrapping around, only the bits before base_index are left to check.
+    if (i == NUM_WORDS)
+      bits &= (u64(1) << shift) - 1;
+    if (bits != 0)
+      return m_base_slot + i * 64 - shift + std::countr_zero(bits);
+  }
+
+  return std::nullopt;
+}
+
+void EventQueue::InsertIntoWheel(const Event& event)
+{
+  // Events in the past go into the first slot. The slots are searched by time anyway, so they
+  // still run first and in the right order.
+  const u32 index = GetIndex(std::max(GetSlot(event.time), m_base_slot));
+  m_slots[index].push_back(event);
+  m_occupied[index / 64] |= u64(1) << (index % 64);
+  ++m_wheel_size;
+}
+
+void EventQueue::Rebase(s64 slot)
+{
+  m_base_slot = slot;
+  while (!m_far_events.empty() && GetSlot(m_far_events.front().time) < m_base_slot + NUM_SLOTS)
+  {
+    InsertIntoWheel(m_far_events.front());
+    std::ranges::pop_heap(m_far_events, std::ranges::greater{});
+    m_far_events.pop_back();
+  }
+}
+
+void EventQueue::Settle()
+{
+  if (m_wheel_size != 0)
+    Rebase(*GetFirstOccupiedSlot());
+  else if (!m_far_events.empty())
+    Rebase(GetSlot(m_far_events.front().time));
+}
+
 CoreTimingManager::CoreTimingManager(Core::System& system) : m_system(system)
 {
 }
@@ -76,7 +216,7 @@ EventType* CoreTimingManager::RegisterEvent(const std::string& name, TimedCallba
 
 void CoreTimingManager::UnregisterAllEvents()
 {
-  ASSERT_MSG(POWERPC, m_event_queue.empty(), "Cannot unregister events with events pending");
+  ASSERT_MSG(POWERPC, m_event_queue.Empty(), "Cannot unregister events with events pending");
   m_event_types.clear();
 }
 
@@ -161,7 +301,13 @@ void CoreTimingManager::DoState(PointerWrap& p)
   p.DoMarker("CoreTimingData");
 
   MoveEvents();
-  p.DoEachElement(m_event_queue, [this](PointerWrap& pw, Event& ev) {
+
+  // Events are saved in the order they will run in, so that the same state always produces the
+  // same data regardless of how the queue is laid out in memory.
+  std::vector<Event> events;
+  if (!p.IsReadMode())
+    events = m_event_queue.GetSortedEvents();
+  p.DoEachElement(events, [this](PointerWrap& pw, Event& ev) {
     pw.Do(ev.time);
     pw.Do(ev.fifo_order);
 
@@ -196,10 +342,11 @@ void CoreTimingManager::DoState(PointerWrap& p)
 
   if (p.IsReadMode())
   {
-    // When loading from a save state, we must assume the Event order is random and meaningless.
-    // The exact layout of the heap in memory is implementation defined, therefore it is platform
-    // and library version specific.
-    std::ranges::make_heap(m_event_queue, std::ranges::greater{});
+    // Older save states stored the events in heap order, which is implementation defined, so
+    // don't assume any particular order here.
+    m_event_queue.Clear();
+    for (const Event& ev : events)
+      m_event_queue.Push(ev);
 
     // The stave state has changed the time, so our previous Throttle targets are invalid.
     // Especially when global_time goes down; So we create a fake throttle update.
@@ -227,7 +374,7 @@ u64 CoreTimingManager::GetIdleTicks() const
 
 void CoreTimingManager::ClearPendingEvents()
 {
-  m_event_queue.clear();
+  m_event_queue.Clear();
 }
 
 void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_type, u64 userdata,
@@ -256,8 +403,7 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
     if (!m_is_global_timer_sane)
       ForceExceptionCheck(cycles_into_future);
 
-    m_event_queue.emplace_back(Event{timeout, m_event_fifo_id++, userdata, event_type});
-    std::ranges::push_heap(m_event_queue, std::ranges::greater{});
+    m_event_queue.Push(Event{timeout, m_event_fifo_id++, userdata, event_type});
   }
   else
   {
@@ -276,14 +422,7 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
 
 void CoreTimingManager::RemoveEvent(EventType* event_type)
 {
-  const size_t erased =
-      std::erase_if(m_event_queue, [&](const Event& e) { return e.type == event_type; });
-
-  // Removing random items breaks the invariant so we have to re-establish it.
-  if (erased != 0)
-  {
-    std::ranges::make_heap(m_event_queue, std::ranges::greater{});
-  }
+  m_event_queue.RemoveIf([&](const Event& e) { return e.type == event_type; });
 }
 
 void CoreTimingManager::RemoveAllEvents(EventType* event_type)
@@ -310,8 +449,7 @@ void CoreTimingManager::MoveEvents()
   for (Event ev; m_ts_queue.Pop(ev);)
   {
     ev.fifo_order = m_event_fifo_id++;
-    m_event_queue.emplace_back(std::move(ev));
-    std::ranges::push_heap(m_event_queue, std::ranges::greater{});
+    m_event_queue.Push(ev);
   }
 }
 
@@ -332,21 +470,19 @@ void CoreTimingManager::Advance()
 
   m_is_global_timer_sane = true;
 
-  while (!m_event_queue.empty() && m_event_queue.front().time <= m_globals.global_timer)
+  while (!m_event_queue.Empty() && m_event_queue.Top().time <= m_globals.global_timer)
   {
-    Event evt = std::move(m_event_queue.front());
-    std::ranges::pop_heap(m_event_queue, std::ranges::greater{});
-    m_event_queue.pop_back();
+    const Event evt = m_event_queue.Pop();
     evt.type->callback(m_system, evt.userdata, m_globals.global_timer - evt.time);
   }
 
   m_is_global_timer_sane = false;
 
   // Still events left (scheduled in the future)
-  if (!m_event_queue.empty())
+  if (!m_event_queue.Empty())
   {
     m_globals.slice_length = static_cast<int>(
-        std::min<s64>(m_event_queue.front().time - m_globals.global_timer, MAX_SLICE_LENGTH));
+        std::min<s64>(m_event_queue.Top().time - m_globals.global_timer, MAX_SLICE_LENGTH));
   }
 
   ppc_state.downcount = CyclesToDowncount(m_globals.slice_length);
@@ -496,9 +632,7 @@ bool CoreTimingManager::UseSyncOnSkipIdle() const
 
 void CoreTimingManager::LogPendingEvents() const
 {
-  auto clone = m_event_queue;
-  std::ranges::sort(clone);
-  for (const Event& ev : clone)
+  for (const Event& ev : m_event_queue.GetSortedEvents())
   {
     INFO_LOG_FMT(POWERPC, "PENDING: Now: {} Pending: {} Type: {}", m_globals.global_timer, ev.time,
                  *ev.type->name);
@@ -514,11 +648,10 @@ void CoreTimingManager::AdjustEventQueueTimes(u32 new_ppc_clock, u32 old_ppc_clo
 
   g_perf_metrics.AdjustClockSpeed(ticks, new_ppc_clock, old_ppc_clock);
 
-  for (Event& ev : m_event_queue)
-  {
-    const s64 ev_ticks = (ev.time - ticks) * new_ppc_clock / old_ppc_clock;
-    ev.time = ticks + ev_ticks;
-  }
+  m_event_queue.AdjustTimes([&](s64& time) {
+    const s64 ev_ticks = (time - ticks) * new_ppc_clock / old_ppc_clock;
+    time = ticks + ev_ticks;
+  });
 }
 
 void CoreTimingManager::Idle()
@@ -542,9 +675,7 @@ std::string CoreTimingManager::GetScheduledEventsSummary() const
   std::string text = "Scheduled events\n";
   text.reserve(1000);
 
-  auto clone = m_event_queue;
-  std::ranges::sort(clone);
-  for (const Event& ev : clone)
+  for (const Event& ev : m_event_queue.GetSortedEvents())
   {
     text += fmt::format("{} : {} {:016x}\n", *ev.type->name, ev.time, ev.userdata);
   }
@@ -16,7 +16,11 @@
 // inside callback:
 //   ScheduleEvent(periodInCycles - cyclesLate, callback, "whatever")
 
+#include <algorithm>
+#include <array>
+#include <functional>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -72,6 +76,108 @@ struct Event
   }
 };
 
+// Pending events, ordered by time and then by the order they were added in.
+//
+// Most events are scheduled less than a few frames ahead and are constantly rescheduled (audio
+// DMA, SI polling, VI, GPU sync), so those are kept in a timing wheel: a ring of slots, each of
+// which holds the events for a fixed range of cycles, plus a bitmap of the non-empty slots. Adding
+// an event is O(1), and the earliest event is found by scanning the bitmap and the (small) first
+// slot. Events beyond the end of the wheel go to a min-heap and are moved into the wheel as it
+// advances.
+//
+// The order events are returned in only depends on their (time, fifo_order) keys, so it doesn't
+// depend on how the events are distributed between the wheel and the heap.
+class EventQueue
+{
+public:
+  static constexpr u32 SLOT_SHIFT = 8;
+  static constexpr u32 NUM_SLOTS = 1024;
+
+  bool Empty() const { return m_size == 0; }
+  size_t Size() const { return m_size; }
+
+  // Must not be called when the queue is empty.
+  const Event& Top() const;
+  Event Pop();
+  void Push(const Event& event);
+
+  template <typename Predicate>
+  size_t RemoveIf(Predicate predicate);
+
+  // Calls the functor with a reference to the time of every event. The order is unspecified.
+  template <typename Functor>
+  void AdjustTimes(Functor functor);
+
+  void Clear();
+
+  // Returns every pending event in the order they will run in.
+  std::vector<Event> GetSortedEvents() const;
+
+private:
+  static s64 GetSlot(s64 time) { return time >> SLOT_SHIFT; }
+  static u32 GetIndex(s64 slot) { return static_cast<u32>(slot & (NUM_SLOTS - 1)); }
+
+  const Event* FindEarliestInWheel() const;
+  std::optional<s64> GetFirstOccupiedSlot() const;
+  void InsertIntoWheel(const Event& event);
+  // Moves the start of the wheel to the given slot, which must not be after the first occupied
+  // slot, and moves every far event that now fits into the wheel.
+  void Rebase(s64 slot);
+  void Settle();
+
+  std::array<std::vector<Event>, NUM_SLOTS> m_slots;
+  std::array<u64, NUM_SLOTS / 64> m_occupied{};
+  // Absolute slot number (time >> SLOT_SHIFT) of the first slot in the wheel.
+  s64 m_base_slot = 0;
+  size_t m_wheel_size = 0;
+  // Min-heap (using std::ranges::greater) of the events that don't fit in the wheel.
+  std::vector<Event> m_far_events;
+  size_t m_size = 0;
+};
+
+template <typename Predicate>
+size_t EventQueue::RemoveIf(Predicate predicate)
+{
+  size_t erased = 0;
+  for (u32 i = 0; i < NUM_SLOTS; ++i)
+  {
+    if (!(m_occupied[i / 64] & (u64(1) << (i % 64))))
+      continue;
+
+    const size_t slot_erased = std::erase_if(m_slots[i], predicate);
+    if (m_slots[i].empty())
+      m_occupied[i / 64] &= ~(u64(1) << (i % 64));
+    m_wheel_size -= slot_erased;
+    erased += slot_erased;
+  }
+
+  const size_t far_erased = std::erase_if(m_far_events, predicate);
+  if (far_erased != 0)
+  {
+    // Removing random items breaks the heap invariant so we have to re-establish it.
+    std::ranges::make_heap(m_far_events, std::ranges::greater{});
+    erased += far_erased;
+  }
+
+  m_size -= erased;
+  if (erased != 0)
+    Settle();
+  return erased;
+}
+
+template <typename Functor>
+void EventQueue::AdjustTimes(Functor functor)
+{
+  // This only happens when the CPU clock changes, so just rebuild the queue.
+  std::vector<Event> events = GetSortedEvents();
+  Clear();
+  for (Event& event : events)
+  {
+    functor(event.time);
+    Push(event);
+  }
+}
+
 enum class FromThread
 {
   CPU,
@@ -179,11 +285,7 @@ private:
   std::unordered_map<std::string, EventType> m_event_types;
 
   // STATE_TO_SAVE
-  // The queue is a min-heap using std::ranges::make_heap/push_heap/pop_heap.
-  // We don't use std::priority_queue because we need to be able to serialize, unserialize and
-  // erase arbitrary events (RemoveEvent()) regardless of the queue order. These aren't accommodated
-  // by the standard adaptor class.
-  std::vector<Event> m_event_queue;
+  EventQueue m_event_queue;
   u64 m_event_fifo_id = 0;
   std::mutex m_ts_write_lock;
   Common::SPSCQueue<Event> m_ts_queue;
@@ -302,6 +302,8 @@ void AudioInterfaceManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
                    core_timing.RemoveEvent(ai.m_event_type_ai);
                    core_timing.ScheduleEvent(ai.GetAIPeriod(), ai.m_event_type_ai);
                  }));
+  // The sample counter advances with every CPU tick, not only when the AI event runs.
+  mmio->MarkReadAsVolatile(base | AI_SAMPLE_COUNTER, sizeof(u32));
 
   mmio->Register(base | AI_INTERRUPT_TIMING, MMIO::DirectRead<u32>(&m_interrupt_timing),
                  MMIO::ComplexWrite<u32>([](Core::System& system, u32, u32 val) {
@@ -247,6 +247,8 @@ void DSPManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
                    return dsp.m_dsp_emulator->DSP_ReadMailBoxLow(false);
                  }),
                  MMIO::InvalidWrite<u16>());
+  // Reading the low half acknowledges the mail.
+  mmio->MarkReadAsVolatile(base | DSP_MAIL_FROM_DSP_LO, sizeof(u16));
 
   mmio->Register(
       base | DSP_CONTROL, MMIO::ComplexRead<u16>([](Core::System& system, u32) {
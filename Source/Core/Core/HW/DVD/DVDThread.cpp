@@ -3,12 +3,18 @@
 
 #include "Core/HW/DVD/DVDThread.h"
 
+#include <algorithm>
+#include <bit>
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include <fmt/format.h>
+
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
@@ -26,11 +32,25 @@
 #include "Core/IOS/ES/Formats.h"
 #include "Core/System.h"
 
+#include "DiscIO/Blob.h"
 #include "DiscIO/Enums.h"
 #include "DiscIO/Volume.h"
 
 namespace DVD
 {
+static void TouchPages(const u8* data, u64 size)
+{
+  constexpr u64 PAGE_SIZE = 0x1000;
+
+  u8 sum = 0;
+  for (u64 i = 0; i < size; i += PAGE_SIZE)
+    sum += static_cast<const volatile u8*>(data)[i];
+  if (size != 0)
+    sum += static_cast<const volatile u8*>(data)[size - 1];
+
+  [[maybe_unused]] volatile u8 sink = sum;
+}
+
 DVDThread::DVDThread(Core::System& system) : m_system(system)
 {
 }
@@ -56,22 +76,25 @@ void DVDThread::Stop()
   m_result_queue.Clear();
   m_result_map.clear();
 
+  ResetReadAheadWindows();
+  LogAndResetReadStatistics();
   m_disc.reset();
 }
 
 void DVDThread::DoState(PointerWrap& p)
 {
-  // Ensure all requests are completed with results Push'd to m_result_queue.
-  WaitUntilIdle();
-
-  // Move all results from result_queue to result_map because
-  // PointerWrap::Do supports std::map but not Common::WaitableSPSCQueue.
-  // This won't affect the behavior of FinishRead.
-  ReadResult result;
-  while (m_result_queue.Pop(result))
-    m_result_map.emplace(result.first.id, std::move(result));
+  // Savestates must not depend on the disc image being memory mapped when they are loaded
+  CopyMappedResults();
+
+  // Results are stored as pairs of the request and its data
+  std::map<u64, std::pair<ReadRequest, std::vector<u8>>> results;
+  for (auto& [id, result] : m_result_map)
+    results.emplace(id, std::pair(result.request, std::move(result.buffer)));
+  p.Do(results);
+  m_result_map.clear();
+  for (auto& [id, result] : results)
+    m_result_map.emplace(id, ReadResult{result.first, std::move(result.second)});
 
-  p.Do(m_result_map);
   p.Do(m_next_id);
 
   // m_disc isn't savestated (because it points to files on the
@@ -102,7 +125,10 @@ void DVDThread::DoState(PointerWrap& p)
 
 void DVDThread::SetDisc(std::unique_ptr<DiscIO::Volume> disc)
 {
-  WaitUntilIdle();
+  // Reads that are still in flight deliver the data that was read from the old disc
+  CopyMappedResults();
+  ResetReadAheadWindows();
+  LogAndResetReadStatistics();
   m_disc = std::move(disc);
 }
 
@@ -218,6 +244,54 @@ void DVDThread::StartReadInternal(bool copy_to_ram, u32 output_address, u64 dvd_
   core_timing.ScheduleEvent(ticks_until_completion, m_finish_read, id);
 }
 
+DVDThread::ReadStatistics DVDThread::GetReadStatistics() const
+{
+  ReadStatistics statistics{.num_reads = m_num_reads,
+                            .num_blob_reads = m_num_blob_reads.load(),
+                            .num_read_ahead_hits = m_num_read_ahead_hits.load(),
+                            .time_to_data_histogram = m_time_to_data_histogram};
+  if (m_disc)
+    statistics.cache = m_disc->GetBlobReader().GetCacheStatistics();
+  return statistics;
+}
+
+void DVDThread::LogAndResetReadStatistics()
+{
+  if (m_num_reads != 0)
+  {
+    const ReadStatistics statistics = GetReadStatistics();
+
+    std::string histogram;
+    for (size_t i = 0; i < NUM_TIME_TO_DATA_BUCKETS; ++i)
+    {
+      const bool last = i == NUM_TIME_TO_DATA_BUCKETS - 1;
+      histogram += fmt::format("{}{}{} us: {}", i == 0 ? "" : ", ", last ? ">=" : "<",
+                               FIRST_TIME_TO_DATA_BUCKET_US << (last ? i - 1 : i),
+                               statistics.time_to_data_histogram[i]);
+    }
+    INFO_LOG_FMT(DVDINTERFACE,
+                 "{} disc reads ({} reads of the disc image, {} served by read-ahead), "
+                 "time to data: {}",
+                 statistics.num_reads, statistics.num_blob_reads, statistics.num_read_ahead_hits,
+                 histogram);
+
+    if (statistics.cache)
+    {
+      const DiscIO::BlobCacheStatistics& cache = *statistics.cache;
+      INFO_LOG_FMT(DVDINTERFACE,
+                   "Disc cache: {} hits, {} read-ahead hits, {} misses. Wii encryption cache: "
+                   "{} hits, {} misses, {} thrashes",
+                   cache.hits, cache.read_ahead_hits, cache.misses, cache.encrypted_group_hits,
+                   cache.encrypted_group_misses, cache.encrypted_group_thrashes);
+    }
+  }
+
+  m_num_reads = 0;
+  m_time_to_data_histogram = {};
+  m_num_blob_reads = 0;
+  m_num_read_ahead_hits = 0;
+}
+
 void DVDThread::GlobalFinishRead(Core::System& system, u64 id, s64 cycles_late)
 {
   system.GetDVDThread().FinishRead(id, cycles_late);
@@ -248,16 +322,26 @@ void DVDThread::FinishRead(u64 id, s64 cycles_late)
     {
       m_result_queue.WaitForData();
       m_result_queue.Pop(result);
-      if (result.first.id == id)
+      if (result.request.id == id)
         break;
 
-      m_result_map.emplace(result.first.id, std::move(result));
+      m_result_map.emplace(result.request.id, std::move(result));
     }
   }
   // We have now obtained the right ReadResult.
 
-  const ReadRequest& request = result.first;
-  const std::vector<u8>& buffer = result.second;
+  const ReadRequest& request = result.request;
+  std::span<const u8> buffer = result.buffer;
+  if (result.mapped_data)
+    buffer = {result.mapped_data, request.length};
+
+  const u64 time_to_data_us = request.realtime_done_us - request.realtime_started_us;
+  const size_t bucket =
+      time_to_data_us < FIRST_TIME_TO_DATA_BUCKET_US ?
+          0 :
+          std::bit_width(time_to_data_us / FIRST_TIME_TO_DATA_BUCKET_US);
+  ++m_num_reads;
+  ++m_time_to_data_histogram[std::min(bucket, NUM_TIME_TO_DATA_BUCKETS - 1)];
 
   DEBUG_LOG_FMT(DVDINTERFACE,
                 "Disc has been read. Real time: {} us. "
@@ -293,16 +377,154 @@ void DVDThread::FinishRead(u64 id, s64 cycles_late)
   dvd_interface.FinishExecutingCommand(request.reply_type, interrupt, cycles_late, buffer);
 }
 
+void DVDThread::CopyMappedResults()
+{
+  // Ensure all requests are completed with results Push'd to m_result_queue.
+  WaitUntilIdle();
+
+  // Move all results from result_queue to result_map, so that all of them can be reached.
+  // This won't affect the behavior of FinishRead.
+  ReadResult result;
+  while (m_result_queue.Pop(result))
+    m_result_map.emplace(result.request.id, std::move(result));
+
+  for (auto& [id, map_result] : m_result_map)
+  {
+    if (map_result.mapped_data)
+    {
+      map_result.buffer.assign(map_result.mapped_data,
+                               map_result.mapped_data + map_result.request.length);
+      map_result.mapped_data = nullptr;
+    }
+  }
+}
+
 void DVDThread::ProcessReadRequest(ReadRequest&& request)
 {
   m_file_logger.Log(*m_disc, request.partition, request.dvd_offset);
 
-  std::vector<u8> buffer(request.length);
-  if (!m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
-    buffer.resize(0);
+  // If the disc image is memory mapped, FinishRead copies the data straight from the mapping to
+  // emulated RAM. Only reads into emulated RAM skip the buffer, since other reads need to hold on
+  // to the data. Every page is touched here first, so that page faults and disk I/O happen on the
+  // DVD thread instead of stalling the CPU thread, and so that the time to data includes them.
+  // Reading ahead would only add copies for mapped images, so they skip the windows.
+  const u8* mapped_data =
+      m_disc->GetMappedData(request.dvd_offset, request.length, request.partition);
+
+  ReadResult result;
+  if (request.copy_to_ram && mapped_data)
+  {
+    TouchPages(mapped_data, request.length);
+    result.mapped_data = mapped_data;
+  }
+  else
+  {
+    std::vector<u8>& buffer = result.buffer;
+    buffer.resize(request.length);
+    const bool success =
+        mapped_data || request.length >= MAX_READ_AHEAD_SIZE ?
+            ReadFromDisc(request.dvd_offset, request.length, buffer.data(), request.partition) :
+            ReadThroughWindows(request, buffer.data());
+    if (!success)
+      buffer.resize(0);
+  }
 
   request.realtime_done_us = Common::Timer::NowUs();
 
-  m_result_queue.Push(ReadResult(std::move(request), std::move(buffer)));
+  result.request = std::move(request);
+  m_result_queue.Push(std::move(result));
+
+  // Reading ahead is speculative, so it must not delay the result that FinishRead may be waiting on
+  ExtendReadAheadWindow();
+}
+
+bool DVDThread::ReadFromDisc(u64 offset, u64 length, u8* out, const DiscIO::Partition& partition)
+{
+  ++m_num_blob_reads;
+  return m_disc->Read(offset, length, out, partition);
+}
+
+bool DVDThread::ReadThroughWindows(const ReadRequest& request, u8* out)
+{
+  // This only changes what the host reads and when. The time at which the emulated software sees
+  // the read complete is still decided by the event that StartReadInternal schedules.
+  const u64 start = request.dvd_offset;
+  const u64 end = start + request.length;
+  const u64 now = ++m_read_ahead_counter;
+
+  for (ReadAheadWindow& window : m_read_ahead_windows)
+  {
+    if (window.Contains(request.partition, start, end))
+    {
+      std::copy_n(window.data.begin() + (start - window.offset), request.length, out);
+      window.last_used = now;
+      ++m_num_read_ahead_hits;
+      return true;
+    }
+  }
+
+  // A request that starts inside or right after a window continues that window's stream. Only the
+  // part that the window doesn't contain yet is read, and the window is then extended further ahead
+  // than last time. Otherwise the least recently used window is replaced, and it isn't extended
+  // until the new stream turns out to be sequential.
+  u64 read_ahead_size = 0;
+  u64 bytes_in_window = 0;
+  auto window = std::ranges::find_if(m_read_ahead_windows, [&](const ReadAheadWindow& w) {
+    return w.partition == request.partition && !w.data.empty() && start >= w.offset &&
+           start <= w.offset + w.data.size();
+  });
+  if (window != m_read_ahead_windows.end())
+  {
+    bytes_in_window = window->offset + window->data.size() - start;
+    std::copy_n(window->data.begin() + (start - window->offset), bytes_in_window, out);
+    read_ahead_size =
+        std::clamp(window->read_ahead_size * 2, MIN_READ_AHEAD_SIZE, MAX_READ_AHEAD_SIZE);
+  }
+  else
+  {
+    window = std::ranges::min_element(m_read_ahead_windows, {}, &ReadAheadWindow::last_used);
+  }
+
+  if (!ReadFromDisc(start + bytes_in_window, request.length - bytes_in_window,
+                    out + bytes_in_window, request.partition))
+  {
+    *window = {};
+    return false;
+  }
+
+  window->partition = request.partition;
+  window->offset = start;
+  window->data.assign(out, out + request.length);
+  window->read_ahead_size = read_ahead_size;
+  window->last_used = now;
+  if (read_ahead_size != 0)
+    m_window_to_extend = &*window;
+
+  return true;
+}
+
+void DVDThread::ExtendReadAheadWindow()
+{
+  if (!m_window_to_extend)
+    return;
+
+  ReadAheadWindow& window = *m_window_to_extend;
+  m_window_to_extend = nullptr;
+
+  const size_t old_size = window.data.size();
+  window.data.resize(old_size + window.read_ahead_size);
+  if (!ReadFromDisc(window.offset + old_size, window.read_ahead_size, window.data.data() + old_size,
+                    window.partition))
+  {
+    // Reading ahead may have gone past the end of the disc or partition
+    window.data.resize(old_size);
+  }
+}
+
+void DVDThread::ResetReadAheadWindows()
+{
+  m_read_ahead_windows = {};
+  m_read_ahead_counter = 0;
+  m_window_to_extend = nullptr;
 }
 }  // namespace DVD
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <optional>
@@ -16,6 +18,7 @@
 #include "Core/HW/DVD/DVDInterface.h"
 #include "Core/HW/DVD/FileMonitor.h"
 
+#include "DiscIO/Blob.h"
 #include "DiscIO/Volume.h"
 
 class PointerWrap;
@@ -51,6 +54,21 @@ enum class ReplyType : u32;
 class DVDThread
 {
 public:
+  // Bucket i counts reads that took less than 64 << i microseconds from being started to their
+  // data being available. The last bucket also counts everything slower than that.
+  static constexpr size_t NUM_TIME_TO_DATA_BUCKETS = 12;
+  static constexpr u64 FIRST_TIME_TO_DATA_BUCKET_US = 64;
+
+  struct ReadStatistics
+  {
+    u64 num_reads = 0;
+    // Reads of the disc image. Requests served from a read-ahead window don't cause any.
+    u64 num_blob_reads = 0;
+    u64 num_read_ahead_hits = 0;
+    std::array<u64, NUM_TIME_TO_DATA_BUCKETS> time_to_data_histogram{};
+    std::optional<DiscIO::BlobCacheStatistics> cache;
+  };
+
   explicit DVDThread(Core::System& system);
   DVDThread(const DVDThread&) = delete;
   DVDThread(DVDThread&&) = delete;
@@ -84,8 +102,12 @@ public:
                               const DiscIO::Partition& partition, DVD::ReplyType reply_type,
                               s64 ticks_until_completion);
 
+  // Statistics for the reads of the current disc. Only call this from the CPU thread.
+  ReadStatistics GetReadStatistics() const;
+
 private:
   void WaitUntilIdle();
+  void LogAndResetReadStatistics();
 
   void StartReadInternal(bool copy_to_ram, u32 output_address, u64 dvd_offset, u32 length,
                          const DiscIO::Partition& partition, DVD::ReplyType reply_type,
@@ -118,9 +140,46 @@ private:
     u64 realtime_done_us = 0;
   };
 
-  void ProcessReadRequest(ReadRequest&& read_request);
+  // A copy of the disc data around the most recent reads of one access stream, so that requests
+  // that are adjacent to or overlap earlier ones don't each need a separate read of the disc image.
+  // While a stream keeps reading sequentially, more and more data is read ahead of it.
+  // Only accessed on the DVD thread, except while it is idle.
+  struct ReadAheadWindow
+  {
+    DiscIO::Partition partition{};
+    u64 offset = 0;
+    std::vector<u8> data;
+    u64 read_ahead_size = 0;
+    u64 last_used = 0;
+
+    bool Contains(const DiscIO::Partition& other_partition, u64 start, u64 end) const
+    {
+      return partition == other_partition && start >= offset && end <= offset + data.size();
+    }
+  };
+
+  // Two windows let a game stream DTK audio while it loads files without the two evicting
+  // each other.
+  static constexpr size_t NUM_READ_AHEAD_WINDOWS = 2;
+  static constexpr u64 MIN_READ_AHEAD_SIZE = 0x10000;
+  static constexpr u64 MAX_READ_AHEAD_SIZE = 0x100000;
+
+  // For reads into emulated RAM from a memory mapped disc image, the DVD thread leaves the data in
+  // the mapping and sets mapped_data instead of filling the buffer. The pointer belongs to m_disc,
+  // so such results are copied into their buffers before m_disc changes.
+  struct ReadResult
+  {
+    ReadRequest request;
+    std::vector<u8> buffer;
+    const u8* mapped_data = nullptr;
+  };
 
-  using ReadResult = std::pair<ReadRequest, std::vector<u8>>;
+  void ProcessReadRequest(ReadRequest&& read_request);
+  void CopyMappedResults();
+  bool ReadFromDisc(u64 offset, u64 length, u8* out, const DiscIO::Partition& partition);
+  bool ReadThroughWindows(const ReadRequest& request, u8* out);
+  void ExtendReadAheadWindow();
+  void ResetReadAheadWindows();
 
   CoreTiming::EventType* m_finish_read = nullptr;
 
@@ -133,6 +192,17 @@ private:
 
   std::unique_ptr<DiscIO::Volume> m_disc;
 
+  std::array<ReadAheadWindow, NUM_READ_AHEAD_WINDOWS> m_read_ahead_windows;
+  u64 m_read_ahead_counter = 0;
+  // The window that the last request continued, which gets read further ahead once the result of
+  // that request has been handed to the CPU thread.
+  ReadAheadWindow* m_window_to_extend = nullptr;
+
+  u64 m_num_reads = 0;
+  std::array<u64, NUM_TIME_TO_DATA_BUCKETS> m_time_to_data_histogram{};
+  std::atomic<u64> m_num_blob_reads = 0;
+  std::atomic<u64> m_num_read_ahead_hits = 0;
+
   FileMonitor::FileLogger m_file_logger;
 
   Core::System& m_system;
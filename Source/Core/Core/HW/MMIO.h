@@ -6,6 +6,7 @@
 #include <array>
 #include <atomic>
 #include <bit>
+#include <bitset>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -145,6 +146,25 @@ public:
     GetHandlerForWrite<Unit>(addr).Write(system, addr, val);
   }
 
+  // Reads of volatile registers either have side effects or return a value that changes without a
+  // scheduled CoreTiming event. Loops polling them are not treated as idle loops by the JITs, since
+  // skipping ahead to the next event would change what the guest observes.
+  void MarkReadAsVolatile(u32 addr, u32 size)
+  {
+    for (u32 i = 0; i < size; ++i)
+      m_volatile_reads[UniqueID(addr + i)] = true;
+  }
+
+  bool IsReadVolatile(u32 addr, u32 size) const
+  {
+    for (u32 i = 0; i < size; ++i)
+    {
+      if (m_volatile_reads[UniqueID(addr + i)])
+        return true;
+    }
+    return false;
+  }
+
   // Handlers access interface.
   //
   // Use when you care more about how to access the MMIO register for an
@@ -186,6 +206,8 @@ private:
   HandlerArray<u16>::Write m_write_handlers16;
   HandlerArray<u32>::Write m_write_handlers32;
 
+  std::bitset<NUM_MMIOS> m_volatile_reads;
+
   // Getter functions for the handler arrays.
   template <typename Unit>
   ReadHandler<Unit>& GetReadHandler(size_t index)
@@ -15,6 +15,10 @@
 #include <span>
 #include <tuple>
 
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
@@ -230,11 +234,23 @@ bool MemoryManager::InitFastmemArena()
 
   m_is_fastmem_arena_initialized = true;
   m_fastmem_arena_size = memory_size;
+
+#ifdef _WIN32
+  // Views can only be placed at allocation granularity (64 KiB) boundaries.
+  m_is_page_table_mapping_enabled = false;
+#else
+  m_is_page_table_mapping_enabled = Config::Get(Config::MAIN_FASTMEM_PAGE_TABLE) &&
+                                    sysconf(_SC_PAGESIZE) == PowerPC::HW_PAGE_SIZE;
+#endif
+
   return true;
 }
 
 void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 {
+  // BATs take priority over the page table, so a page table mapping may be covered by a BAT now.
+  RemoveAllPageTableMappings();
+
   for (auto& entry : m_logical_mapped_entries)
   {
     m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
@@ -290,6 +306,69 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
   }
 }
 
+bool MemoryManager::AddPageTableMapping(u32 logical_address, u32 translated_address,
+                                        bool writeable)
+{
+  if (!m_is_page_table_mapping_enabled)
+    return false;
+
+  for (const auto& physical_region : m_physical_regions)
+  {
+    if (!physical_region.active || translated_address < physical_region.physical_address ||
+        translated_address - physical_region.physical_address >= physical_region.size)
+    {
+      continue;
+    }
+
+    RemovePageTableMapping(logical_address);
+
+    const u32 position =
+        physical_region.shm_position + translated_address - physical_region.physical_address;
+    void* mapped_pointer = m_arena.MapInMemoryRegion(position, PowerPC::HW_PAGE_SIZE,
+                                                     m_logical_base + logical_address, writeable);
+    if (!mapped_pointer)
+      return false;
+
+    m_page_table_mapped_entries.emplace(logical_address,
+                                        PageTableMapping{mapped_pointer, writeable});
+    return true;
+  }
+
+  return false;
+}
+
+const PageTableMapping* MemoryManager::GetPageTableMapping(u32 logical_address) const
+{
+  const auto it = m_page_table_mapped_entries.find(logical_address);
+  return it != m_page_table_mapped_entries.end() ? &it->second : nullptr;
+}
+
+void MemoryManager::RemovePageTableMapping(u32 logical_address)
+{
+  const auto it = m_page_table_mapped_entries.find(logical_address);
+  if (it == m_page_table_mapped_entries.end())
+    return;
+
+  m_arena.UnmapFromMemoryRegion(it->second.mapped_pointer, PowerPC::HW_PAGE_SIZE);
+  m_page_table_mapped_entries.erase(it);
+}
+
+void MemoryManager::RemovePageTableMappings(u32 logical_address, u64 size)
+{
+  const auto begin = m_page_table_mapped_entries.lower_bound(logical_address);
+  const auto end = logical_address + size > UINT32_MAX ?
+                       m_page_table_mapped_entries.end() :
+                       m_page_table_mapped_entries.lower_bound(u32(logical_address + size));
+  for (auto it = begin; it != end; ++it)
+    m_arena.UnmapFromMemoryRegion(it->second.mapped_pointer, PowerPC::HW_PAGE_SIZE);
+  m_page_table_mapped_entries.erase(begin, end);
+}
+
+void MemoryManager::RemoveAllPageTableMappings()
+{
+  RemovePageTableMappings(0, u64(UINT32_MAX) + 1);
+}
+
 void MemoryManager::DoState(PointerWrap& p)
 {
   const u32 current_ram_size = GetRamSize();
@@ -377,6 +456,9 @@ void MemoryManager::ShutdownFastmemArena()
   }
   m_logical_mapped_entries.clear();
 
+  RemoveAllPageTableMappings();
+  m_is_page_table_mapping_enabled = false;
+
   m_arena.ReleaseMemoryRegion();
 
   m_fastmem_arena = nullptr;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <map>
 #include <memory>
 #include <span>
 #include <string>
@@ -56,6 +57,12 @@ struct LogicalMemoryView
   u32 mapped_size;
 };
 
+struct PageTableMapping
+{
+  void* mapped_pointer;
+  bool writeable;
+};
+
 class MemoryManager
 {
 public:
@@ -101,6 +108,17 @@ public:
 
   void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table);
 
+  // Page table translations can be mapped into the logical fastmem region one guest page at a time.
+  // This is only possible when host pages are as small as guest pages.
+  bool IsPageTableMappingEnabled() const { return m_is_page_table_mapping_enabled; }
+  // Maps the page at translated_address to logical_address (both page aligned). Returns false if
+  // the page isn't backed by memory that can be mapped.
+  bool AddPageTableMapping(u32 logical_address, u32 translated_address, bool writeable);
+  const PageTableMapping* GetPageTableMapping(u32 logical_address) const;
+  void RemovePageTableMapping(u32 logical_address);
+  void RemovePageTableMappings(u32 logical_address, u64 size);
+  void RemoveAllPageTableMappings();
+
   void Clear();
 
   // Routines to access physically addressed memory, designed for use by
@@ -249,6 +267,10 @@ private:
 
   std::vector<LogicalMemoryView> m_logical_mapped_entries;
 
+  // Pages mapped for page table translations, keyed by logical address.
+  std::map<u32, PageTableMapping> m_page_table_mapped_entries;
+  bool m_is_page_table_mapping_enabled = false;
+
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_physical_page_mappings{};
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_logical_page_mappings{};
 
@@ -337,6 +337,8 @@ void VideoInterfaceManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
             "Changing horizontal beam position to {:#06x} - not documented or implemented yet",
             val);
       }));
+  // The horizontal position is computed from the current tick rather than updated by an event.
+  mmio->MarkReadAsVolatile(base | VI_HORIZONTAL_BEAM_POSITION, sizeof(u16));
 
   // The following MMIOs are interrupts related and update interrupt status
   // on writes.
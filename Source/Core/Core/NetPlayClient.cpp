@@ -894,6 +894,7 @@ void NetPlayClient::OnStartGame(sf::Packet& packet)
     packet >> m_net_settings.sync_gpu_min_distance;
     packet >> m_net_settings.sync_gpu_overclock;
     packet >> m_net_settings.jit_follow_branch;
+    packet >> m_net_settings.jit_superblocks;
     packet >> m_net_settings.fast_disc_speed;
     packet >> m_net_settings.mmu;
     packet >> m_net_settings.fastmem;
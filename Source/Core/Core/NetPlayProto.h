@@ -75,6 +75,7 @@ struct NetSettings
   int sync_gpu_min_distance = 0;
   float sync_gpu_overclock = 0;
   bool jit_follow_branch = false;
+  bool jit_superblocks = false;
   bool fast_disc_speed = false;
   bool mmu = false;
   bool fastmem = false;
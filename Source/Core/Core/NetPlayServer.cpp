@@ -1428,6 +1428,7 @@ bool NetPlayServer::SetupNetSettings()
   settings.sync_gpu_min_distance = Config::Get(Config::MAIN_SYNC_GPU_MIN_DISTANCE);
   settings.sync_gpu_overclock = Config::Get(Config::MAIN_SYNC_GPU_OVERCLOCK);
   settings.jit_follow_branch = Config::Get(Config::MAIN_JIT_FOLLOW_BRANCH);
+  settings.jit_superblocks = Config::Get(Config::MAIN_JIT_SUPERBLOCKS);
   settings.fast_disc_speed = Config::Get(Config::MAIN_FAST_DISC_SPEED);
   settings.mmu = Config::Get(Config::MAIN_MMU);
   settings.fastmem = Config::Get(Config::MAIN_FASTMEM);
@@ -1637,6 +1638,7 @@ bool NetPlayServer::StartGame()
   spac << m_settings.sync_gpu_min_distance;
   spac << m_settings.sync_gpu_overclock;
   spac << m_settings.jit_follow_branch;
+  spac << m_settings.jit_superblocks;
   spac << m_settings.fast_disc_speed;
   spac << m_settings.mmu;
   spac << m_settings.fastmem;
@@ -14,6 +14,7 @@
 #include "Common/Logging/Log.h"
 #include "Core/Core.h"
 #include "Core/Debugger/DebugInterface.h"
+#include "Core/HW/Memmap.h"
 #include "Core/PowerPC/Expression.h"
 #include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/MMU.h"
@@ -292,6 +293,16 @@ void MemChecks::Add(TMemCheck memory_check, bool update)
   // Check for existing breakpoint, and overwrite with new info.
   // This is assuming we usually want the new breakpoint over an old one.
   const u32 address = memory_check.start_address;
+
+  // Fast accesses don't support memchecks, so drop the page table mappings that the new memcheck
+  // overlaps. BAT mappings are updated by Update.
+  auto& memory = m_system.GetMemory();
+  if (memory.IsPageTableMappingEnabled())
+  {
+    const u32 first_page = address & ~static_cast<u32>(PowerPC::HW_PAGE_MASK);
+    memory.RemovePageTableMappings(first_page, u64(memory_check.end_address) - first_page + 1);
+  }
+
   auto old_mem_check = std::ranges::find(m_mem_checks, address, &TMemCheck::start_address);
   if (old_mem_check != m_mem_checks.end())
   {
@@ -3,6 +3,7 @@
 
 #include "Core/PowerPC/CachedInterpreter/CachedInterpreter.h"
 
+#include <bit>
 #include <span>
 #include <sstream>
 #include <utility>
@@ -206,6 +207,124 @@ s32 CachedInterpreter::CheckIdle(PowerPC::PowerPCState& ppc_state,
   return sizeof(AnyCallback) + sizeof(operands);
 }
 
+s32 CachedInterpreter::InterpretPair(PowerPC::PowerPCState& ppc_state,
+                                     const InterpretPairOperands& operands)
+{
+  const auto& [interpreter, first_func, second_func, first_inst, second_inst] = operands;
+  first_func(interpreter, first_inst);
+  second_func(interpreter, second_inst);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::LoadImmediate(PowerPC::PowerPCState& ppc_state,
+                                     const LoadImmediateOperands& operands)
+{
+  const auto& [rd, imm] = operands;
+  ppc_state.gpr[rd] = imm;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::AddImmediate(PowerPC::PowerPCState& ppc_state,
+                                    const AddImmediateOperands& operands)
+{
+  const auto& [rd, ra, imm] = operands;
+  ppc_state.gpr[rd] = ppc_state.gpr[ra] + imm;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::OrImmediate(PowerPC::PowerPCState& ppc_state,
+                                   const LogicalOperands& operands)
+{
+  const auto& [ra, rs, imm] = operands;
+  ppc_state.gpr[ra] = ppc_state.gpr[rs] | imm;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::Or(PowerPC::PowerPCState& ppc_state, const LogicalOperands& operands)
+{
+  const auto& [ra, rs, rb] = operands;
+  ppc_state.gpr[ra] = ppc_state.gpr[rs] | ppc_state.gpr[rb];
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::RotateMask(PowerPC::PowerPCState& ppc_state,
+                                  const RotateMaskOperands& operands)
+{
+  const auto& [ra, rs, sh, mask] = operands;
+  ppc_state.gpr[ra] = std::rotl(ppc_state.gpr[rs], sh) & mask;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::RotateMaskPair(PowerPC::PowerPCState& ppc_state,
+                                      const RotateMaskPairOperands& operands)
+{
+  const auto& [first, second] = operands;
+  ppc_state.gpr[first.ra] = std::rotl(ppc_state.gpr[first.rs], first.sh) & first.mask;
+  ppc_state.gpr[second.ra] = std::rotl(ppc_state.gpr[second.rs], second.sh) & second.mask;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+// Same as Interpreter::Helper_IntCompare.
+template <typename T>
+static void UpdateCRField(PowerPC::PowerPCState& ppc_state, u32 crf, T a, T b)
+{
+  u32 cr_field = a < b ? PowerPC::CR_LT : a > b ? PowerPC::CR_GT : PowerPC::CR_EQ;
+  if (ppc_state.GetXER_SO())
+    cr_field |= PowerPC::CR_SO;
+  ppc_state.cr.SetField(crf, cr_field);
+}
+
+template <bool is_signed>
+s32 CachedInterpreter::CompareImmediate(PowerPC::PowerPCState& ppc_state,
+                                        const CompareOperands& operands)
+{
+  const auto& [crf, ra, imm] = operands;
+  if constexpr (is_signed)
+    UpdateCRField(ppc_state, crf, static_cast<s32>(ppc_state.gpr[ra]), static_cast<s32>(imm));
+  else
+    UpdateCRField(ppc_state, crf, ppc_state.gpr[ra], imm);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+template <bool is_signed>
+s32 CachedInterpreter::CompareRegister(PowerPC::PowerPCState& ppc_state,
+                                       const CompareOperands& operands)
+{
+  const auto& [crf, ra, rb] = operands;
+  if constexpr (is_signed)
+  {
+    UpdateCRField(ppc_state, crf, static_cast<s32>(ppc_state.gpr[ra]),
+                  static_cast<s32>(ppc_state.gpr[rb]));
+  }
+  else
+  {
+    UpdateCRField(ppc_state, crf, ppc_state.gpr[ra], ppc_state.gpr[rb]);
+  }
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+template <bool is_signed>
+s32 CachedInterpreter::CompareImmediateAndBranch(PowerPC::PowerPCState& ppc_state,
+                                                 const CompareImmediateAndBranchOperands& operands)
+{
+  const auto& [compare, interpreter, branch_pc, branch_inst] = operands;
+  if constexpr (is_signed)
+  {
+    UpdateCRField(ppc_state, compare.crf, static_cast<s32>(ppc_state.gpr[compare.ra]),
+                  static_cast<s32>(compare.b));
+  }
+  else
+  {
+    UpdateCRField(ppc_state, compare.crf, ppc_state.gpr[compare.ra], compare.b);
+  }
+
+  // The branch itself still goes through the interpreter to handle CTR and Branch Watch.
+  ppc_state.pc = branch_pc;
+  ppc_state.npc = branch_pc + 4;
+  Interpreter::bcx(interpreter, branch_inst);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
 bool CachedInterpreter::HandleFunctionHooking(u32 address)
 {
   // CachedInterpreter inherits from JitBase and is considered a JIT by relevant code.
@@ -237,6 +356,145 @@ void CachedInterpreter::WriteEndBlock()
   }
 }
 
+void CachedInterpreter::BeginInstruction(u32 index)
+{
+  PPCAnalyst::CodeOp& op = m_code_buffer[index];
+  js.op = &op;
+
+  js.compilerPC = op.address;
+  js.instructionsLeft = (code_block.m_num_instructions - 1) - index;
+  js.downcountAmount += op.opinfo->num_cycles;
+  if (op.opinfo->flags & FL_LOADSTORE)
+    ++js.numLoadStoreInst;
+  if (op.opinfo->flags & FL_USE_FPU)
+    ++js.numFloatingPointInst;
+}
+
+bool CachedInterpreter::ShouldCheckExceptions(const PPCAnalyst::CodeOp& op) const
+{
+  // Instruction may cause a DSI Exception or Program Exception.
+  return (jo.memcheck && (op.opinfo->flags & FL_LOADSTORE) != 0) ||
+         (!op.canEndBlock && ShouldHandleFPExceptionForInstruction(&op));
+}
+
+bool CachedInterpreter::CanFuseWithNextInstruction(u32 index) const
+{
+  // Breakpoint checks have to be written between instructions.
+  if (index + 1 >= code_block.m_num_instructions || IsDebuggingEnabled())
+    return false;
+
+  const PPCAnalyst::CodeOp& next = m_code_buffer[index + 1];
+  if (next.skip || (!js.firstFPInstructionFound && (next.opinfo->flags & FL_USE_FPU) != 0))
+    return false;
+
+  return !HLE::TryReplaceFunction(m_ppc_symbol_db, next.address, PowerPC::CoreMode::JIT);
+}
+
+static bool IsRotateMaskWithoutRc(UGeckoInstruction inst)
+{
+  return inst.OPCD == 21 && !inst.Rc;
+}
+
+bool CachedInterpreter::WriteSpecializedInstructions(u32& index)
+{
+  const UGeckoInstruction inst = m_code_buffer[index].inst;
+  const PPCAnalyst::CodeOp* const next =
+      CanFuseWithNextInstruction(index) ? &m_code_buffer[index + 1] : nullptr;
+  const auto get_rotate_mask_operands = [](UGeckoInstruction rlwinm) -> RotateMaskOperands {
+    return {rlwinm.RA, rlwinm.RS, rlwinm.SH, MakeRotationMask(rlwinm.MB, rlwinm.ME)};
+  };
+
+  // Compare immediate followed by a conditional branch.
+  if (next && (inst.OPCD == 10 || inst.OPCD == 11) && next->inst.OPCD == 16)
+  {
+    const bool is_signed = inst.OPCD == 11;
+    const CompareImmediateAndBranchOperands operands = {
+        {inst.CRFD, inst.RA, is_signed ? u32(inst.SIMM_16) : u32(inst.UIMM)},
+        m_system.GetInterpreter(),
+        next->address,
+        next->inst};
+    Write(is_signed ? CallbackCast(CompareImmediateAndBranch<true>) :
+                      CallbackCast(CompareImmediateAndBranch<false>),
+          operands);
+    BeginInstruction(++index);
+    return true;
+  }
+
+  // Chains of rlwinm, e.g. for extracting bit fields.
+  if (next && IsRotateMaskWithoutRc(inst) && IsRotateMaskWithoutRc(next->inst))
+  {
+    Write(RotateMaskPair,
+          {get_rotate_mask_operands(inst), get_rotate_mask_operands(next->inst)});
+    BeginInstruction(++index);
+    return true;
+  }
+
+  switch (inst.OPCD)
+  {
+  case 10:  // cmpli
+    Write(CompareImmediate<false>, {inst.CRFD, inst.RA, u32(inst.UIMM)});
+    return true;
+  case 11:  // cmpi
+    Write(CompareImmediate<true>, {inst.CRFD, inst.RA, u32(inst.SIMM_16)});
+    return true;
+  case 14:  // addi
+  case 15:  // addis
+  {
+    const u32 imm = inst.OPCD == 14 ? u32(inst.SIMM_16) : u32(inst.SIMM_16 << 16);
+    if (inst.RA == 0)
+      Write(LoadImmediate, {inst.RD, imm});
+    else
+      Write(AddImmediate, {inst.RD, inst.RA, imm});
+    return true;
+  }
+  case 21:  // rlwinm
+    if (inst.Rc)
+      break;
+    Write(RotateMask, get_rotate_mask_operands(inst));
+    return true;
+  case 24:  // ori
+  case 25:  // oris
+  {
+    const u32 imm = inst.OPCD == 24 ? u32{inst.UIMM} : u32{inst.UIMM} << 16;
+    // ori r0, r0, 0 is the canonical nop.
+    if (imm == 0 && inst.RA == inst.RS)
+      return true;
+    Write(OrImmediate, {inst.RA, inst.RS, imm});
+    return true;
+  }
+  case 31:
+    if (inst.SUBOP10 == 0)  // cmp
+    {
+      Write(CompareRegister<true>, {inst.CRFD, inst.RA, inst.RB});
+      return true;
+    }
+    if (inst.SUBOP10 == 32)  // cmpl
+    {
+      Write(CompareRegister<false>, {inst.CRFD, inst.RA, inst.RB});
+      return true;
+    }
+    if (inst.SUBOP10 == 444 && !inst.Rc)  // or
+    {
+      Write(Or, {inst.RA, inst.RS, inst.RB});
+      return true;
+    }
+    break;
+  }
+
+  // Anything else, e.g. a load followed by an addi, or psq_l followed by a paired single op, can
+  // still share one callback with the next instruction.
+  if (next && !next->canEndBlock && !ShouldCheckExceptions(*next))
+  {
+    Write(InterpretPair,
+          {m_system.GetInterpreter(), Interpreter::GetInterpreterOp(inst),
+           Interpreter::GetInterpreterOp(next->inst), inst, next->inst});
+    BeginInstruction(++index);
+    return true;
+  }
+
+  return false;
+}
+
 bool CachedInterpreter::SetEmitterStateToFreeCodeRegion()
 {
   const auto free = m_free_ranges.by_size_begin();
@@ -345,16 +603,8 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 
   for (u32 i = 0; i < code_block.m_num_instructions; i++)
   {
-    PPCAnalyst::CodeOp& op = m_code_buffer[i];
-    js.op = &op;
-
-    js.compilerPC = op.address;
-    js.instructionsLeft = (code_block.m_num_instructions - 1) - i;
-    js.downcountAmount += op.opinfo->num_cycles;
-    if (op.opinfo->flags & FL_LOADSTORE)
-      ++js.numLoadStoreInst;
-    if (op.opinfo->flags & FL_USE_FPU)
-      ++js.numFloatingPointInst;
+    BeginInstruction(i);
+    const PPCAnalyst::CodeOp& op = m_code_buffer[i];
 
     if (HandleFunctionHooking(js.compilerPC))
       break;
@@ -372,9 +622,7 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
         js.firstFPInstructionFound = true;
       }
 
-      // Instruction may cause a DSI Exception or Program Exception.
-      if ((jo.memcheck && (op.opinfo->flags & FL_LOADSTORE) != 0) ||
-          (!op.canEndBlock && ShouldHandleFPExceptionForInstruction(&op)))
+      if (ShouldCheckExceptions(op))
       {
         const InterpretAndCheckExceptionsOperands operands = {
             {interpreter, Interpreter::GetInterpreterOp(op.inst), js.compilerPC, op.inst},
@@ -384,7 +632,7 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
                                CallbackCast(InterpretAndCheckExceptions<false>),
               operands);
       }
-      else
+      else if (op.canEndBlock || !WriteSpecializedInstructions(i))
       {
         const InterpretOperands operands = {interpreter, Interpreter::GetInterpreterOp(op.inst),
                                             js.compilerPC, op.inst};
@@ -392,9 +640,11 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
               operands);
       }
 
-      if (op.branchIsIdleLoop)
+      // A fused callback may have handled the following instruction as well.
+      const PPCAnalyst::CodeOp& last_op = m_code_buffer[i];
+      if (last_op.branchIsIdleLoop)
         Write(CheckIdle, {m_system.GetCoreTiming(), js.blockStart});
-      if (op.canEndBlock)
+      if (last_op.canEndBlock)
         WriteEndBlock();
     }
   }
@@ -64,6 +64,14 @@ private:
   bool HandleFunctionHooking(u32 address);
   void WriteEndBlock();
 
+  void BeginInstruction(u32 index);
+  bool ShouldCheckExceptions(const PPCAnalyst::CodeOp& op) const;
+  // Returns true if nothing has to be written between the instruction at index and the next one.
+  bool CanFuseWithNextInstruction(u32 index) const;
+  // Writes a specialized or fused callback for the instruction at index if there is one. Advances
+  // index past the last instruction that was handled.
+  bool WriteSpecializedInstructions(u32& index);
+
   // Finds a free memory region and sets the code emitter to point at that region.
   // Returns false if no free memory region can be found.
   bool SetEmitterStateToFreeCodeRegion();
@@ -82,6 +90,14 @@ private:
   struct WriteBrokenBlockNPCOperands;
   struct CheckHaltOperands;
   struct CheckIdleOperands;
+  struct InterpretPairOperands;
+  struct LoadImmediateOperands;
+  struct AddImmediateOperands;
+  struct LogicalOperands;
+  struct RotateMaskOperands;
+  struct RotateMaskPairOperands;
+  struct CompareOperands;
+  struct CompareImmediateAndBranchOperands;
 
   static s32 StartProfiledBlock(PowerPC::PowerPCState& ppc_state,
                                 const StartProfiledBlockOperands& operands);
@@ -112,6 +128,39 @@ private:
   static s32 CheckIdle(PowerPC::PowerPCState& ppc_state, const CheckIdleOperands& operands);
   static s32 CheckIdle(std::ostream& stream, const CheckIdleOperands& operands);
 
+  // Fused and specialized handlers. These skip the dispatch through Interpreter::m_op_table for
+  // common instructions whose operands are known when the block is compiled.
+  static s32 InterpretPair(PowerPC::PowerPCState& ppc_state, const InterpretPairOperands& operands);
+  static s32 InterpretPair(std::ostream& stream, const InterpretPairOperands& operands);
+  static s32 LoadImmediate(PowerPC::PowerPCState& ppc_state,
+                           const LoadImmediateOperands& operands);
+  static s32 LoadImmediate(std::ostream& stream, const LoadImmediateOperands& operands);
+  static s32 AddImmediate(PowerPC::PowerPCState& ppc_state, const AddImmediateOperands& operands);
+  static s32 AddImmediate(std::ostream& stream, const AddImmediateOperands& operands);
+  static s32 OrImmediate(PowerPC::PowerPCState& ppc_state, const LogicalOperands& operands);
+  static s32 OrImmediate(std::ostream& stream, const LogicalOperands& operands);
+  static s32 Or(PowerPC::PowerPCState& ppc_state, const LogicalOperands& operands);
+  static s32 Or(std::ostream& stream, const LogicalOperands& operands);
+  static s32 RotateMask(PowerPC::PowerPCState& ppc_state, const RotateMaskOperands& operands);
+  static s32 RotateMask(std::ostream& stream, const RotateMaskOperands& operands);
+  static s32 RotateMaskPair(PowerPC::PowerPCState& ppc_state,
+                            const RotateMaskPairOperands& operands);
+  static s32 RotateMaskPair(std::ostream& stream, const RotateMaskPairOperands& operands);
+  template <bool is_signed>
+  static s32 CompareImmediate(PowerPC::PowerPCState& ppc_state, const CompareOperands& operands);
+  template <bool is_signed>
+  static s32 CompareImmediate(std::ostream& stream, const CompareOperands& operands);
+  template <bool is_signed>
+  static s32 CompareRegister(PowerPC::PowerPCState& ppc_state, const CompareOperands& operands);
+  template <bool is_signed>
+  static s32 CompareRegister(std::ostream& stream, const CompareOperands& operands);
+  template <bool is_signed>
+  static s32 CompareImmediateAndBranch(PowerPC::PowerPCState& ppc_state,
+                                       const CompareImmediateAndBranchOperands& operands);
+  template <bool is_signed>
+  static s32 CompareImmediateAndBranch(std::ostream& stream,
+                                       const CompareImmediateAndBranchOperands& operands);
+
   HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges;
   CachedInterpreterBlockCache m_block_cache;
 };
@@ -175,3 +224,64 @@ struct CachedInterpreter::CheckIdleOperands
   CoreTiming::CoreTimingManager& core_timing;
   u32 idle_pc;
 };
+
+struct CachedInterpreter::InterpretPairOperands
+{
+  Interpreter& interpreter;
+  void (*first_func)(Interpreter&, UGeckoInstruction);   // Interpreter::Instruction
+  void (*second_func)(Interpreter&, UGeckoInstruction);  // Interpreter::Instruction
+  UGeckoInstruction first_inst;
+  UGeckoInstruction second_inst;
+};
+
+struct CachedInterpreter::LoadImmediateOperands
+{
+  u32 rd;
+  u32 imm;
+};
+
+struct CachedInterpreter::AddImmediateOperands
+{
+  u32 rd;
+  u32 ra;
+  u32 imm;
+  u32 : 32;
+};
+
+struct CachedInterpreter::LogicalOperands
+{
+  u32 ra;
+  u32 rs;
+  u32 b;  // Immediate or register, depending on the callback
+  u32 : 32;
+};
+
+struct CachedInterpreter::RotateMaskOperands
+{
+  u32 ra;
+  u32 rs;
+  u32 sh;
+  u32 mask;
+};
+
+struct CachedInterpreter::RotateMaskPairOperands
+{
+  RotateMaskOperands first;
+  RotateMaskOperands second;
+};
+
+struct CachedInterpreter::CompareOperands
+{
+  u32 crf;
+  u32 ra;
+  u32 b;  // Immediate or register, depending on the callback
+  u32 : 32;
+};
+
+struct CachedInterpreter::CompareImmediateAndBranchOperands
+{
+  CompareOperands compare;
+  Interpreter& interpreter;
+  u32 branch_pc;
+  UGeckoInstruction branch_inst;
+};
@@ -90,6 +90,89 @@ s32 CachedInterpreter::CheckIdle(std::ostream& stream, const CheckIdleOperands&
   return sizeof(AnyCallback) + sizeof(operands);
 }
 
+s32 CachedInterpreter::InterpretPair(std::ostream& stream, const InterpretPairOperands& operands)
+{
+  fmt::println(stream, "InterpretPair(first_inst=0x{:08x}, second_inst=0x{:08x})",
+               operands.first_inst.hex, operands.second_inst.hex);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::LoadImmediate(std::ostream& stream, const LoadImmediateOperands& operands)
+{
+  const auto& [rd, imm] = operands;
+  fmt::println(stream, "LoadImmediate(rd={}, imm=0x{:08x})", rd, imm);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::AddImmediate(std::ostream& stream, const AddImmediateOperands& operands)
+{
+  const auto& [rd, ra, imm] = operands;
+  fmt::println(stream, "AddImmediate(rd={}, ra={}, imm=0x{:08x})", rd, ra, imm);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::OrImmediate(std::ostream& stream, const LogicalOperands& operands)
+{
+  const auto& [ra, rs, imm] = operands;
+  fmt::println(stream, "OrImmediate(ra={}, rs={}, imm=0x{:08x})", ra, rs, imm);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::Or(std::ostream& stream, const LogicalOperands& operands)
+{
+  const auto& [ra, rs, rb] = operands;
+  fmt::println(stream, "Or(ra={}, rs={}, rb={})", ra, rs, rb);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::RotateMask(std::ostream& stream, const RotateMaskOperands& operands)
+{
+  const auto& [ra, rs, sh, mask] = operands;
+  fmt::println(stream, "RotateMask(ra={}, rs={}, sh={}, mask=0x{:08x})", ra, rs, sh, mask);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::RotateMaskPair(std::ostream& stream, const RotateMaskPairOperands& operands)
+{
+  const auto& [first, second] = operands;
+  fmt::println(stream,
+               "RotateMaskPair(ra={}, rs={}, sh={}, mask=0x{:08x}; ra={}, rs={}, sh={}, "
+               "mask=0x{:08x})",
+               first.ra, first.rs, first.sh, first.mask, second.ra, second.rs, second.sh,
+               second.mask);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+template <bool is_signed>
+s32 CachedInterpreter::CompareImmediate(std::ostream& stream, const CompareOperands& operands)
+{
+  const auto& [crf, ra, imm] = operands;
+  fmt::println(stream, "CompareImmediate<is_signed={:5}>(crf={}, ra={}, imm=0x{:08x})", is_signed,
+               crf, ra, imm);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+template <bool is_signed>
+s32 CachedInterpreter::CompareRegister(std::ostream& stream, const CompareOperands& operands)
+{
+  const auto& [crf, ra, rb] = operands;
+  fmt::println(stream, "CompareRegister<is_signed={:5}>(crf={}, ra={}, rb={})", is_signed, crf, ra,
+               rb);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+template <bool is_signed>
+s32 CachedInterpreter::CompareImmediateAndBranch(std::ostream& stream,
+                                                 const CompareImmediateAndBranchOperands& operands)
+{
+  const auto& [compare, interpreter, branch_pc, branch_inst] = operands;
+  fmt::println(stream,
+               "CompareImmediateAndBranch<is_signed={:5}>(crf={}, ra={}, imm=0x{:08x}, "
+               "branch_pc=0x{:08x}, branch_inst=0x{:08x})",
+               is_signed, compare.crf, compare.ra, compare.b, branch_pc, branch_inst.hex);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
 static std::once_flag s_sorted_lookup_flag;
 
 std::size_t CachedInterpreter::Disassemble(const JitBlock& block, std::ostream& stream)
@@ -115,6 +198,19 @@ std::size_t CachedInterpreter::Disassemble(const JitBlock& block, std::ostream&
       LOOKUP_KV(CachedInterpreter::CheckFPU),
       LOOKUP_KV(CachedInterpreter::CheckBreakpoint),
       LOOKUP_KV(CachedInterpreter::CheckIdle),
+      LOOKUP_KV(CachedInterpreter::InterpretPair),
+      LOOKUP_KV(CachedInterpreter::LoadImmediate),
+      LOOKUP_KV(CachedInterpreter::AddImmediate),
+      LOOKUP_KV(CachedInterpreter::OrImmediate),
+      LOOKUP_KV(CachedInterpreter::Or),
+      LOOKUP_KV(CachedInterpreter::RotateMask),
+      LOOKUP_KV(CachedInterpreter::RotateMaskPair),
+      LOOKUP_KV(CachedInterpreter::CompareImmediate<false>),
+      LOOKUP_KV(CachedInterpreter::CompareImmediate<true>),
+      LOOKUP_KV(CachedInterpreter::CompareRegister<false>),
+      LOOKUP_KV(CachedInterpreter::CompareRegister<true>),
+      LOOKUP_KV(CachedInterpreter::CompareImmediateAndBranch<false>),
+      LOOKUP_KV(CachedInterpreter::CompareImmediateAndBranch<true>),
   });
 
 #undef LOOKUP_KV
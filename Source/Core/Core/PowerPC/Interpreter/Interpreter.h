@@ -36,6 +36,9 @@ public:
   void Shutdown() override;
   void SingleStep() override;
   int SingleStepInner();
+  // Runs instructions up to and including the next one that ends a block in the fast run loop
+  // (a branch, rfi or an exception). Returns the number of cycles taken.
+  int RunBlock();
 
   void Run() override;
   void ClearCache() override;
@@ -296,6 +296,7 @@ void Jit64::Init()
   code_block.m_stats = &js.st;
   code_block.m_gpa = &js.gpa;
   code_block.m_fpa = &js.fpa;
+  analyzer.SetHotBranches(&js.superblockBranchAddresses);
   EnableOptimization();
 
   ResetFreeMemoryRanges();
@@ -304,6 +305,8 @@ void Jit64::Init()
 void Jit64::ClearCache()
 {
   blocks.Clear();
+  m_branch_profiles.clear();
+  m_cold_block_runs.clear();
   blocks.ClearRangesToFree();
   trampolines.ClearCodeSpace();
   m_far_code.ClearCodeSpace();
@@ -338,6 +341,7 @@ void Jit64::ResetFreeMemoryRanges()
 
 void Jit64::Shutdown()
 {
+  SaveWarmStartCache();
   FreeCodeSpace();
 
   auto& memory = m_system.GetMemory();
@@ -672,6 +676,67 @@ void Jit64::WriteIdleExit(u32 destination)
   WriteExceptionExit();
 }
 
+bool Jit64::IsSuperblockCandidate(const PPCAnalyst::CodeOp& op) const
+{
+  if (!m_enable_superblocks || !m_enable_branch_following ||
+      !analyzer.HasOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW))
+  {
+    return false;
+  }
+
+  // Mirrors the conditions under which PPCAnalyzer follows a hot conditional branch.
+  const UGeckoInstruction inst = op.inst;
+  const bool is_conditional =
+      (inst.BO & BO_DONT_DECREMENT_FLAG) == 0 || (inst.BO & BO_DONT_CHECK_CONDITION) == 0;
+  return inst.OPCD == 16 && !inst.LK && is_conditional && op.branchTo > op.address &&
+         op.branchTo != js.blockStart && !op.branchIsIdleLoop && !op.branchIsFollowedConditional;
+}
+
+void Jit64::WriteBranchProfileTaken(u32 branch_address)
+{
+  MOV(64, R(RSCRATCH), ImmPtr(&m_branch_profiles[branch_address]));
+  SUB(32, MDisp(RSCRATCH, offsetof(BranchProfile, taken_countdown)), Imm8(1));
+  FixupBranch hot = J_CC(CC_Z, Jump::Near);
+
+  SwitchToFarCode();
+  SetJumpTarget(hot);
+  ABI_PushRegistersAndAdjustStack({}, 0);
+  ABI_CallFunctionPC(PromoteHotBranch, this, branch_address);
+  ABI_PopRegistersAndAdjustStack({}, 0);
+  FixupBranch back = J(Jump::Near);
+  SwitchToNearCode();
+
+  SetJumpTarget(back);
+}
+
+void Jit64::WriteBranchProfileNotTaken(u32 branch_address)
+{
+  MOV(64, R(RSCRATCH), ImmPtr(&m_branch_profiles[branch_address]));
+  ADD(32, MDisp(RSCRATCH, offsetof(BranchProfile, not_taken)), Imm8(1));
+}
+
+void Jit64::PromoteHotBranch(Jit64& jit, u32 branch_address)
+{
+  BranchProfile& profile = jit.m_branch_profiles[branch_address];
+  const u32 not_taken = profile.not_taken;
+  profile.taken_countdown = SUPERBLOCK_PROFILE_INTERVAL;
+  profile.not_taken = 0;
+
+  // Only inline paths that are taken much more often than not; otherwise the fall-through exit
+  // would cost as much as the exit being removed.
+  if (not_taken > SUPERBLOCK_PROFILE_INTERVAL / SUPERBLOCK_MIN_TAKEN_RATIO)
+    return;
+
+  if (!jit.js.superblockBranchAddresses.insert(branch_address).second)
+    return;
+
+  DEBUG_LOG_FMT(DYNA_REC, "Forming superblock through hot branch at {:08x}", branch_address);
+
+  // Invalidate every block containing the branch so that it gets recompiled with the taken path
+  // inlined. This is safe to do from within the block being invalidated.
+  jit.GetBlockCache()->InvalidateICache(branch_address, 4, true);
+}
+
 void Jit64::WriteExceptionExit()
 {
   Cleanup();
@@ -748,7 +813,37 @@ void Jit64::Trace()
 
 void Jit64::Jit(u32 em_address)
 {
+  if (InterpretColdBlock(em_address))
+    return;
+
   Jit(em_address, true);
+  CompileWarmStartBlocks();
+}
+
+bool Jit64::InterpretColdBlock(u32 em_address)
+{
+  // Blocks compiled ahead of time by the warm start cache are not being executed yet.
+  if (!m_interpret_cold_blocks || m_compiling_warm_start_blocks || IsDebuggingEnabled() ||
+      em_address != m_ppc_state.pc)
+  {
+    return false;
+  }
+
+  const u64 key = (u64{m_ppc_state.feature_flags} << 32) | em_address;
+  const auto it = m_cold_block_runs.try_emplace(key, 0).first;
+  if (it->second == COLD_BLOCK_INTERPRETER_RUNS)
+  {
+    m_cold_block_runs.erase(it);
+    return false;
+  }
+  ++it->second;
+
+  m_ppc_state.downcount -= m_system.GetInterpreter().RunBlock();
+
+  // The interpreted code may have changed MSR.DR or taken an exception. The dispatcher checks the
+  // downcount before looking up the next block, see Jit64AsmRoutineManager::Generate.
+  m_system.GetJitInterface().UpdateMembase();
+  return true;
 }
 
 void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
@@ -925,7 +1020,7 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   // this lets them use fastmem).
   if (!js.pairedQuantizeAddresses.contains(js.blockStart))
   {
-    // If there are GQRs used but not set, we'll treat those as constant and optimize them
+    // If there are GQRs used before being set, we'll treat those as constant and optimize them
     BitSet8 gqr_static = ComputeStaticGQRs(code_block);
     if (gqr_static)
     {
@@ -1234,7 +1329,9 @@ std::size_t Jit64::DisassembleFarCode(const JitBlock& block, std::ostream& strea
 
 BitSet8 Jit64::ComputeStaticGQRs(const PPCAnalyst::CodeBlock& cb) const
 {
-  return cb.m_gqr_used & ~cb.m_gqr_modified;
+  // GQRs that the block writes to before using them don't need a guess, since mtspr keeps track of
+  // the values written when they are known at compile time.
+  return cb.m_gqr_used_before_modified;
 }
 
 BitSet32 Jit64::CallerSavedRegistersInUse() const
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <optional>
+#include <unordered_map>
 
 #include <rangeset/rangesizeset.h>
 
@@ -63,6 +64,9 @@ public:
   // Jit!
 
   void Jit(u32 em_address) override;
+  // Runs the block at em_address in the interpreter instead of compiling it, if it has not been
+  // run often enough yet. Returns false if the block should be compiled.
+  bool InterpretColdBlock(u32 em_address);
   void Jit(u32 em_address, bool clear_cache_and_retry_on_failure);
   bool DoJit(u32 em_address, JitBlock* b, u32 nextPC);
 
@@ -113,6 +117,14 @@ public:
 
   bool Cleanup();
 
+  // Superblock formation. The taken exits of forward conditional branches are counted, and once a
+  // branch leaves its block often enough, the block is recompiled with the taken path inlined.
+  bool IsSuperblockCandidate(const PPCAnalyst::CodeOp& op) const;
+  // Must only be used after the register caches have been flushed.
+  void WriteBranchProfileTaken(u32 branch_address);
+  // Only clobbers RSCRATCH and the host flags.
+  void WriteBranchProfileNotTaken(u32 branch_address);
+
   void GenerateConstantOverflow(bool overflow);
   void GenerateConstantOverflow(s64 val);
   void GenerateOverflow(Gen::CCFlags cond = Gen::CCFlags::CC_NO);
@@ -280,6 +292,22 @@ private:
 
   static void ImHere(Jit64& jit);
 
+  // Number of times a block is run in the interpreter before it gets compiled. Code that only runs
+  // once or twice, such as initialization code after a level load, is then never compiled.
+  static constexpr u32 COLD_BLOCK_INTERPRETER_RUNS = 2;
+
+  // Number of taken exits between two evaluations of a branch profile.
+  static constexpr u32 SUPERBLOCK_PROFILE_INTERVAL = 1024;
+  // A branch is inlined when it is taken at least this many times as often as it falls through.
+  static constexpr u32 SUPERBLOCK_MIN_TAKEN_RATIO = 4;
+
+  struct BranchProfile
+  {
+    u32 taken_countdown = SUPERBLOCK_PROFILE_INTERVAL;
+    u32 not_taken = 0;
+  };
+  static void PromoteHotBranch(Jit64& jit, u32 branch_address);
+
   JitBlockCache blocks{*this};
   TrampolineCache trampolines{*this};
 
@@ -291,6 +319,12 @@ private:
   HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges_near;
   HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges_far;
 
+  // Referenced by pointer from generated code, so entries are only removed on a full cache clear.
+  std::unordered_map<u32, BranchProfile> m_branch_profiles;
+
+  // Number of dispatcher misses that were interpreted so far, keyed by feature flags and address.
+  std::unordered_map<u64, u32> m_cold_block_runs;
+
   const bool m_im_here_debug = false;
   const bool m_im_here_log = false;
   std::map<u32, int> m_been_here;
@@ -218,9 +218,19 @@ void Jit64AsmRoutineManager::Generate()
   // If jitting triggered an ISI exception, MSR.DR may have changed
   MOV(64, R(RMEM), PPCSTATE(mem_ptr));
 
+  // A cold block may have been interpreted instead of compiled, using up the rest of the slice.
+  FixupBranch interpreted_slice_end;
+  if (m_jit.IsColdBlockInterpretationEnabled())
+  {
+    CMP(32, PPCSTATE(downcount), Imm8(0));
+    interpreted_slice_end = J_CC(CC_LE, Jump::Near);
+  }
+
   JMP(dispatcher_no_check, Jump::Near);
 
   SetJumpTarget(bail);
+  if (m_jit.IsColdBlockInterpretationEnabled())
+    SetJumpTarget(interpreted_slice_end);
   do_timing = GetCodePtr();
 
   // make sure npc contains the next pc (needed for exception checking in CoreTiming::Advance)
@@ -208,6 +208,36 @@ void Jit64::bcx(UGeckoInstruction inst)
         JumpIfCRFieldBit(inst.BI >> 2, 3 - (inst.BI & 3), !(inst.BO_2 & BO_BRANCH_IF_TRUE));
   }
 
+  if (js.op->branchIsFollowedConditional)
+  {
+    // The taken path was inlined into this superblock, so the fall-through path is the exit.
+    SwitchToFarCode();
+    if ((inst.BO & BO_DONT_CHECK_CONDITION) == 0)
+      SetJumpTarget(pConditionDontBranch);
+    if ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0)
+      SetJumpTarget(pCTRDontBranch);
+    {
+      RCForkGuard gpr_guard = gpr.Fork();
+      RCForkGuard fpr_guard = fpr.Fork();
+      gpr.Flush();
+      fpr.Flush();
+      if (IsDebuggingEnabled())
+      {
+        // ABI_PARAM1 is safe to use after a GPR flush for an optimization in this function.
+        WriteBranchWatch<false>(js.compilerPC, js.compilerPC + 4, inst, ABI_PARAM1, RSCRATCH, {});
+      }
+      WriteExit(js.compilerPC + 4);
+    }
+    SwitchToNearCode();
+
+    if (IsDebuggingEnabled())
+    {
+      WriteBranchWatch<true>(js.compilerPC, js.op->branchTo, inst, RSCRATCH, RSCRATCH2,
+                             CallerSavedRegistersInUse());
+    }
+    return;
+  }
+
   if (inst.LK)
     MOV(32, PPCSTATE_LR, Imm32(js.compilerPC + 4));
 
@@ -232,6 +262,8 @@ void Jit64::bcx(UGeckoInstruction inst)
     return;
   }
 
+  const bool profile_branch = IsSuperblockCandidate(*js.op);
+
   {
     RCForkGuard gpr_guard = gpr.Fork();
     RCForkGuard fpr_guard = fpr.Fork();
@@ -243,6 +275,8 @@ void Jit64::bcx(UGeckoInstruction inst)
       // ABI_PARAM1 is safe to use after a GPR flush for an optimization in this function.
       WriteBranchWatch<true>(js.compilerPC, js.op->branchTo, inst, ABI_PARAM1, RSCRATCH, {});
     }
+    if (profile_branch)
+      WriteBranchProfileTaken(js.compilerPC);
     if (js.op->branchIsIdleLoop)
     {
       WriteIdleExit(js.op->branchTo);
@@ -269,10 +303,15 @@ void Jit64::bcx(UGeckoInstruction inst)
     }
     WriteExit(js.compilerPC + 4);
   }
-  else if (IsDebuggingEnabled())
+  else
   {
-    WriteBranchWatch<false>(js.compilerPC, js.compilerPC + 4, inst, RSCRATCH, RSCRATCH2,
-                            CallerSavedRegistersInUse());
+    if (IsDebuggingEnabled())
+    {
+      WriteBranchWatch<false>(js.compilerPC, js.compilerPC + 4, inst, RSCRATCH, RSCRATCH2,
+                              CallerSavedRegistersInUse());
+    }
+    if (profile_branch)
+      WriteBranchProfileNotTaken(js.compilerPC);
   }
 }
 
@@ -414,6 +414,8 @@ void Jit64::DoMergedBranch()
       // ABI_PARAM1 is safe to use after a GPR flush for an optimization in this function.
       WriteBranchWatch<true>(nextPC, destination, next, ABI_PARAM1, RSCRATCH, {});
     }
+    if (IsSuperblockCandidate(js.op[1]))
+      WriteBranchProfileTaken(nextPC);
     WriteExit(destination, next.LK, nextPC + 4);
   }
   else if ((next.OPCD == 19) && (next.SUBOP10 == 528))  // bcctrx
@@ -481,6 +483,35 @@ void Jit64::DoMergedBranchCondition()
     break;
   }
 
+  if (js.op[1].branchIsFollowedConditional)
+  {
+    // The taken path was inlined into this superblock, so the fall-through path is the exit.
+    SwitchToFarCode();
+    SetJumpTarget(pDontBranch);
+    {
+      RCForkGuard gpr_guard = gpr.Fork();
+      RCForkGuard fpr_guard = fpr.Fork();
+
+      gpr.Flush();
+      fpr.Flush();
+
+      if (IsDebuggingEnabled())
+      {
+        // ABI_PARAM1 is safe to use after a GPR flush for an optimization in this function.
+        WriteBranchWatch<false>(nextPC, nextPC + 4, next, ABI_PARAM1, RSCRATCH, {});
+      }
+      WriteExit(nextPC + 4);
+    }
+    SwitchToNearCode();
+
+    if (IsDebuggingEnabled())
+    {
+      WriteBranchWatch<true>(nextPC, js.op[1].branchTo, next, RSCRATCH, RSCRATCH2,
+                             CallerSavedRegistersInUse());
+    }
+    return;
+  }
+
   {
     RCForkGuard gpr_guard = gpr.Fork();
     RCForkGuard fpr_guard = fpr.Fork();
@@ -504,10 +535,15 @@ void Jit64::DoMergedBranchCondition()
     }
     WriteExit(nextPC + 4);
   }
-  else if (IsDebuggingEnabled())
+  else
   {
-    WriteBranchWatch<false>(nextPC, nextPC + 4, next, RSCRATCH, RSCRATCH2,
-                            CallerSavedRegistersInUse());
+    if (IsDebuggingEnabled())
+    {
+      WriteBranchWatch<false>(nextPC, nextPC + 4, next, RSCRATCH, RSCRATCH2,
+                              CallerSavedRegistersInUse());
+    }
+    if (IsSuperblockCandidate(js.op[1]))
+      WriteBranchProfileNotTaken(nextPC);
   }
 }
 
@@ -539,7 +575,30 @@ void Jit64::DoMergedBranchImmediate(s64 val)
     break;
   }
 
-  if (branch)
+  if (js.op[1].branchIsFollowedConditional)
+  {
+    // The taken path was inlined into this superblock, so only falling through leaves it.
+    if (branch)
+    {
+      if (IsDebuggingEnabled())
+      {
+        WriteBranchWatch<true>(nextPC, js.op[1].branchTo, next, RSCRATCH, RSCRATCH2,
+                               CallerSavedRegistersInUse());
+      }
+    }
+    else
+    {
+      gpr.Flush();
+      fpr.Flush();
+      if (IsDebuggingEnabled())
+      {
+        // ABI_PARAM1 is safe to use after a GPR flush for an optimization in this function.
+        WriteBranchWatch<false>(nextPC, nextPC + 4, next, ABI_PARAM1, RSCRATCH, {});
+      }
+      WriteExit(nextPC + 4);
+    }
+  }
+  else if (branch)
   {
     gpr.Flush();
     fpr.Flush();
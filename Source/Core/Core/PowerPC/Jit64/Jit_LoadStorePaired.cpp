@@ -15,8 +15,9 @@
 
 using namespace Gen;
 
-// The big problem is likely instructions that set the quantizers in the same block.
-// We will have to break block after quantizers are written to.
+// GQR values are known at compile time either because the block guards on the value the GQR had
+// when it was compiled (see Jit64::DoJit), or because a preceding mtspr in the same block wrote a
+// known constant to it (see Jit64::mtspr).
 void Jit64::psq_stXX(UGeckoInstruction inst)
 {
   INSTRUCTION_START
@@ -56,16 +57,13 @@ void Jit64::psq_stXX(UGeckoInstruction inst)
   if (gqrIsConstant)
   {
     const u32 gqrValue = js.constantGqr[i] & 0xffff;
-    int type = gqrValue & 0x7;
+    const auto type = static_cast<EQuantizeType>(gqrValue & 0x7);
 
-    // Paired stores (other than w/type zero) don't yield any real change in
-    // performance right now, but if we can improve fastmem support this might change
-    if (gqrValue == 0)
+    // Inline stores can use fastmem, unlike the asm routines. The scale is ignored for floats.
+    if (type == QUANTIZE_FLOAT || type == QUANTIZE_U8 || type == QUANTIZE_U16 ||
+        type == QUANTIZE_S8 || type == QUANTIZE_S16)
     {
-      if (w)
-        GenQuantizedStore(true, static_cast<EQuantizeType>(type), (gqrValue & 0x3F00) >> 8);
-      else
-        GenQuantizedStore(false, static_cast<EQuantizeType>(type), (gqrValue & 0x3F00) >> 8);
+      GenQuantizedStore(w != 0, type, type == QUANTIZE_FLOAT ? 0 : (gqrValue & 0x3F00) >> 8);
     }
     else
     {
@@ -225,10 +225,21 @@ static void DoICacheReset(PowerPC::PowerPCState& ppc_state, JitInterface& jit_in
 void Jit64::mtspr(UGeckoInstruction inst)
 {
   INSTRUCTION_START
-  JITDISABLE(bJITSystemRegistersOff);
   u32 iIndex = (inst.SPRU << 5) | (inst.SPRL & 0x1F);
   int d = inst.RD;
 
+  // Let the quantized loads and stores that follow in this block use the new GQR value if it is
+  // known. This has to happen even if we fall back to the interpreter.
+  if (iIndex >= SPR_GQR0 && iIndex < SPR_GQR0 + 8)
+  {
+    const int gqr = iIndex - SPR_GQR0;
+    js.constantGqrValid[gqr] = gpr.IsImm(d);
+    if (gpr.IsImm(d))
+      js.constantGqr[gqr] = gpr.Imm32(d);
+  }
+
+  JITDISABLE(bJITSystemRegistersOff);
+
   switch (iIndex)
   {
   case SPR_DMAU:
@@ -13,6 +13,7 @@
 
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
+#include "Core/HW/Memmap.h"
 #include "Core/PowerPC/Interpreter/ExceptionUtils.h"
 #include "Core/PowerPC/PPCTables.h"
 #include "Core/PowerPC/PowerPC.h"
@@ -295,6 +296,8 @@ void JitArm64::mtsr(UGeckoInstruction inst)
 {
   INSTRUCTION_START
   JITDISABLE(bJITSystemRegistersOff);
+  // Page table mappings in the segment have to be removed.
+  FALLBACK_IF(m_system.GetMemory().IsPageTableMappingEnabled());
 
   STR(IndexType::Unsigned, gpr.R(inst.RS), PPC_REG, PPCSTATE_OFF_SR(inst.SR));
 }
@@ -321,6 +324,7 @@ void JitArm64::mtsrin(UGeckoInstruction inst)
 {
   INSTRUCTION_START
   JITDISABLE(bJITSystemRegistersOff);
+  FALLBACK_IF(m_system.GetMemory().IsPageTableMappingEnabled());
 
   u32 b = inst.RB, d = inst.RD;
   gpr.BindToRegister(d, d == b);
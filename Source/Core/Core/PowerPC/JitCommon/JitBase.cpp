@@ -5,10 +5,12 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <utility>
 
 #include "Common/Align.h"
 #include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
 #include "Common/Thread.h"
 
@@ -57,7 +59,10 @@
 // After resetting the stack to the top, we call _resetstkoflw() to restore
 // the guard page at the 256kb mark.
 
-const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JitBase::JIT_SETTINGS{{
+// Time spent compiling blocks from the warm start cache after each dispatcher miss.
+constexpr auto WARM_START_TIME_BUDGET = std::chrono::milliseconds(2);
+
+const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 25> JitBase::JIT_SETTINGS{{
     {&JitBase::bJITOff, &Config::MAIN_DEBUG_JIT_OFF},
     {&JitBase::bJITLoadStoreOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_OFF},
     {&JitBase::bJITLoadStorelXzOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_LXZ_OFF},
@@ -74,6 +79,8 @@ const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JitB
     {&JitBase::m_enable_profiling, &Config::MAIN_DEBUG_JIT_ENABLE_PROFILING},
     {&JitBase::m_enable_debugging, &Config::MAIN_ENABLE_DEBUGGING},
     {&JitBase::m_enable_branch_following, &Config::MAIN_JIT_FOLLOW_BRANCH},
+    {&JitBase::m_enable_superblocks, &Config::MAIN_JIT_SUPERBLOCKS},
+    {&JitBase::m_interpret_cold_blocks, &Config::MAIN_JIT_INTERPRET_COLD_BLOCKS},
     {&JitBase::m_enable_float_exceptions, &Config::MAIN_FLOAT_EXCEPTIONS},
     {&JitBase::m_enable_div_by_zero_exceptions, &Config::MAIN_DIVIDE_BY_ZERO_EXCEPTIONS},
     {&JitBase::m_low_dcbz_hack, &Config::MAIN_LOW_DCBZ_HACK},
@@ -129,6 +136,8 @@ void JitBase::RefreshConfig()
     m_low_dcbz_hack = false;
   }
 
+  m_enable_warm_start = Config::Get(Config::MAIN_JIT_WARM_START);
+
   analyzer.SetDebuggingEnabled(m_enable_debugging);
   analyzer.SetBranchFollowingEnabled(m_enable_branch_following);
   analyzer.SetFloatExceptionsEnabled(m_enable_float_exceptions);
@@ -260,6 +269,88 @@ void JitBase::CleanUpAfterStackFault()
   }
 }
 
+void JitBase::CompileWarmStartBlocks()
+{
+  if (!m_enable_warm_start || m_compiling_warm_start_blocks || IsDebuggingEnabled())
+    return;
+
+  if (!m_warm_start_cache.IsLoaded())
+    m_warm_start_cache.Load(SConfig::GetInstance().GetGameID());
+  if (!m_warm_start_cache.ShouldRetry())
+    return;
+
+  // Jit() calls back into this function.
+  m_compiling_warm_start_blocks = true;
+
+  JitBaseBlockCache& blocks = *GetBlockCache();
+  std::vector<JitWarmStartCache::Entry>& pending = m_warm_start_cache.GetPendingEntries();
+  const auto remove_entry = [&pending, this] {
+    pending[m_warm_start_cursor] = pending.back();
+    pending.pop_back();
+  };
+
+  const TimePoint deadline = Clock::now() + WARM_START_TIME_BUDGET;
+  u32 num_compiled = 0;
+  while (m_warm_start_cursor < pending.size() && Clock::now() < deadline)
+  {
+    const JitWarmStartCache::Entry entry = pending[m_warm_start_cursor];
+    const auto feature_flags = static_cast<CPUEmuFeatureFlags>(entry.feature_flags);
+    if (feature_flags != m_ppc_state.feature_flags)
+    {
+      ++m_warm_start_cursor;
+      continue;
+    }
+
+    if (blocks.GetBlockFromStartAddress(entry.effective_address, feature_flags))
+    {
+      remove_entry();
+      continue;
+    }
+
+    // Only compile the block if the code in memory is what it was compiled from last time.
+    analyzer.Analyze(entry.effective_address, &code_block, &m_code_buffer, m_code_buffer.size());
+    if (code_block.m_memory_exception || code_block.m_num_instructions != entry.num_instructions ||
+        JitWarmStartCache::HashCode(m_code_buffer, entry.num_instructions) != entry.code_hash)
+    {
+      // The code may still be loaded later in this run. Failures are counted once per run when the
+      // cache is saved.
+      ++m_warm_start_cursor;
+      continue;
+    }
+
+    const std::size_t num_blocks = blocks.GetBlockCount();
+    Jit(entry.effective_address);
+    remove_entry();
+    if (blocks.GetBlockCount() <= num_blocks)
+    {
+      // The code cache had to be cleared to make space, so it can't hold the whole working set.
+      WARN_LOG_FMT(DYNA_REC, "JIT cache full, dropping {} warm start blocks", pending.size());
+      pending.clear();
+      break;
+    }
+    ++num_compiled;
+  }
+
+  if (m_warm_start_cursor >= pending.size())
+  {
+    m_warm_start_cursor = 0;
+    m_warm_start_cache.FinishRetry();
+  }
+
+  if (num_compiled != 0)
+    DEBUG_LOG_FMT(DYNA_REC, "Compiled {} warm start blocks ahead of time", num_compiled);
+
+  m_compiling_warm_start_blocks = false;
+}
+
+void JitBase::SaveWarmStartCache()
+{
+  if (m_warm_start_cache.IsLoaded())
+    m_warm_start_cache.Save(GetBlockCache()->GetWarmStartEntries());
+  m_warm_start_cache.Clear();
+  m_warm_start_cursor = 0;
+}
+
 bool JitBase::CanMergeNextInstructions(int count) const
 {
   if (m_system.GetCPU().IsStepping() || js.instructionsLeft < count)
@@ -22,6 +22,7 @@
 #include "Core/PowerPC/CPUCoreBase.h"
 #include "Core/PowerPC/JitCommon/JitAsmCommon.h"
 #include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/JitCommon/JitWarmStartCache.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 
 namespace Core
@@ -130,6 +131,8 @@ protected:
     std::unordered_set<u32> fifoWriteAddresses;
     std::unordered_set<u32> pairedQuantizeAddresses;
     std::unordered_set<u32> noSpeculativeConstantsAddresses;
+    // Conditional branches whose taken path is hot enough to be inlined into a superblock.
+    std::unordered_set<u32> superblockBranchAddresses;
   };
 
   PPCAnalyst::CodeBlock code_block;
@@ -153,6 +156,8 @@ protected:
   bool m_enable_profiling = false;
   bool m_enable_debugging = false;
   bool m_enable_branch_following = false;
+  bool m_enable_superblocks = false;
+  bool m_interpret_cold_blocks = false;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
   bool m_low_dcbz_hack = false;
@@ -165,7 +170,13 @@ protected:
   bool m_cleanup_after_stackfault = false;
   u8* m_stack_guard = nullptr;
 
-  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JIT_SETTINGS;
+  bool m_enable_warm_start = false;
+  bool m_compiling_warm_start_blocks = false;
+  // Index of the next pending warm start entry to check in the current pass.
+  std::size_t m_warm_start_cursor = 0;
+  JitWarmStartCache m_warm_start_cache;
+
+  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 25> JIT_SETTINGS;
 
   bool DoesConfigNeedRefresh() const;
   void RefreshConfig();
@@ -177,6 +188,11 @@ protected:
   void UnprotectStack();
   void CleanUpAfterStackFault();
 
+  // Compiles blocks from the warm start cache whose code is present in memory, for at most a few
+  // milliseconds per call. Called by Jit64 after compiling a block on a dispatcher miss.
+  void CompileWarmStartBlocks();
+  void SaveWarmStartCache();
+
   bool CanMergeNextInstructions(int count) const;
   bool HasConstantCarry() const
   {
@@ -199,6 +215,7 @@ public:
 
   bool IsProfilingEnabled() const { return m_enable_profiling; }
   bool IsDebuggingEnabled() const { return m_enable_debugging; }
+  bool IsColdBlockInterpretationEnabled() const { return m_interpret_cold_blocks; }
 
   static const u8* Dispatch(JitBase& jit);
   virtual JitBaseBlockCache* GetBlockCache() = 0;
@@ -207,6 +224,8 @@ public:
 
   virtual void EraseSingleBlock(const JitBlock& block) = 0;
 
+  void RetryWarmStartBlocks() { m_warm_start_cache.OnCodeInvalidated(); }
+
   // Memory region name, free size, and fragmentation ratio
   using MemoryStats = std::pair<std::string_view, std::pair<std::size_t, double>>;
   virtual std::vector<MemoryStats> GetMemoryStats() const = 0;
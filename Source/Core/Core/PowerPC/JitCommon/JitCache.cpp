@@ -5,13 +5,21 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
+#include <chrono>
 #include <cstring>
 #include <functional>
 #include <map>
 #include <ranges>
 #include <set>
 #include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
+#include <vector>
+
+#include <fmt/format.h>
 
 #include "Common/CommonTypes.h"
 #include "Common/JitRegister.h"
@@ -31,8 +39,8 @@ using namespace Gen;
 
 bool JitBlock::OverlapsPhysicalRange(u32 address, u32 length) const
 {
-  return physical_addresses.lower_bound(address) !=
-         physical_addresses.lower_bound(address + length);
+  const auto it = std::ranges::lower_bound(physical_addresses, address);
+  return it != physical_addresses.end() && *it - address < length;
 }
 
 void JitBlock::ProfileData::BeginProfiling(ProfileData* data)
@@ -47,6 +55,105 @@ void JitBlock::ProfileData::EndProfiling(ProfileData* data, u32 downcount_amount
   data->time_spent += Clock::now() - data->time_start;
 }
 
+BlockRangeMap::BlockRangeMap() = default;
+
+BlockRangeMap::~BlockRangeMap() = default;
+
+void BlockRangeMap::Add(JitBlock* block)
+{
+  // physical_addresses is sorted, so all addresses within a range are adjacent.
+  u32 previous_range = UINT32_MAX;
+  for (const u32 addr : block->physical_addresses)
+  {
+    const u32 range = addr >> RANGE_SHIFT;
+    if (range == previous_range)
+      continue;
+    previous_range = range;
+
+    std::unique_ptr<Leaf>& leaf = m_leaves[range >> LEAF_SHIFT];
+    if (!leaf)
+      leaf = std::make_unique<Leaf>();
+    const u32 index = range & LEAF_MASK;
+    leaf->blocks[index].push_back(block);
+    leaf->occupied[index / 64] |= u64{1} << (index % 64);
+  }
+}
+
+void BlockRangeMap::Remove(const JitBlock* block)
+{
+  u32 previous_range = UINT32_MAX;
+  for (const u32 addr : block->physical_addresses)
+  {
+    const u32 range = addr >> RANGE_SHIFT;
+    if (range == previous_range)
+      continue;
+    previous_range = range;
+
+    Leaf* leaf = m_leaves[range >> LEAF_SHIFT].get();
+    if (!leaf)
+      continue;
+    const u32 index = range & LEAF_MASK;
+    std::vector<JitBlock*>& blocks = leaf->blocks[index];
+    const auto it = std::ranges::find(blocks, block);
+    if (it == blocks.end())
+      continue;
+    *it = blocks.back();
+    blocks.pop_back();
+    if (blocks.empty())
+      leaf->occupied[index / 64] &= ~(u64{1} << (index % 64));
+  }
+}
+
+void BlockRangeMap::Clear()
+{
+  for (std::unique_ptr<Leaf>& leaf : m_leaves)
+    leaf.reset();
+}
+
+void BlockRangeMap::GetOverlappingBlocks(u32 address, u32 length,
+                                         std::vector<JitBlock*>* blocks) const
+{
+  if (length == 0)
+    return;
+
+  const size_t first_new_block = blocks->size();
+  const u32 first_range = address >> RANGE_SHIFT;
+  const u32 last_range = (address + (length - 1)) >> RANGE_SHIFT;
+  for (u32 range = first_range; range <= last_range;)
+  {
+    const u32 last_range_in_leaf = std::min(last_range, range | LEAF_MASK);
+    if (const Leaf* leaf = m_leaves[range >> LEAF_SHIFT].get())
+    {
+      const u32 last_index = last_range_in_leaf & LEAF_MASK;
+      u32 index = range & LEAF_MASK;
+      while (index <= last_index)
+      {
+        const u64 word = leaf->occupied[index / 64] >> (index % 64);
+        if (word == 0)
+        {
+          index = (index | 63) + 1;
+          continue;
+        }
+        index += std::countr_zero(word);
+        if (index > last_index)
+          break;
+
+        for (JitBlock* block : leaf->blocks[index])
+        {
+          if (block->OverlapsPhysicalRange(address, length))
+            blocks->push_back(block);
+        }
+        ++index;
+      }
+    }
+    range = last_range_in_leaf + 1;
+  }
+
+  // Blocks spanning several ranges have been found once per range.
+  std::sort(blocks->begin() + first_new_block, blocks->end());
+  blocks->erase(std::unique(blocks->begin() + first_new_block, blocks->end()), blocks->end());
+}
+
 JitBaseBlockCache::JitBaseBlockCache(JitBase& jit) : m_jit{jit}
 {
 }
@@ -55,7 +162,8 @@ JitBaseBlockCache::~JitBaseBlockCache() = default;
 
 void JitBaseBlockCache::Init()
 {
-  Common::JitRegister::Init(Config::Get(Config::MAIN_PERF_MAP_DIR));
+  Common::JitRegister::Init(Config::Get(Config::MAIN_PERF_MAP_DIR),
+                            Config::Get(Config::MAIN_PERF_JITDUMP));
 
   m_entry_points_ptr = nullptr;
 #ifdef _ARCH_64
@@ -83,13 +191,14 @@ void JitBaseBlockCache::Clear()
   m_jit.js.fifoWriteAddresses.clear();
   m_jit.js.pairedQuantizeAddresses.clear();
   m_jit.js.noSpeculativeConstantsAddresses.clear();
+  m_jit.js.superblockBranchAddresses.clear();
   for (auto& e : block_map)
   {
     DestroyBlock(e.second);
   }
   block_map.clear();
   links_to.clear();
-  block_range_map.clear();
+  block_range_map.Clear();
 
   valid_block.ClearAll();
 
@@ -120,6 +229,18 @@ void JitBaseBlockCache::RunOnBlocks(const Core::CPUThreadGuard&,
     f(e.second);
 }
 
+std::vector<JitWarmStartCache::Entry> JitBaseBlockCache::GetWarmStartEntries() const
+{
+  std::vector<JitWarmStartCache::Entry> entries;
+  entries.reserve(block_map.size());
+  for (const auto& [start_address, block] : block_map)
+  {
+    entries.push_back({block.effectiveAddress, static_cast<u32>(block.feature_flags),
+                       block.originalSize, 0, block.code_hash});
+  }
+  return entries;
+}
+
 void JitBaseBlockCache::WipeBlockProfilingData(const Core::CPUThreadGuard&)
 {
   for (const auto& kv : block_map)
@@ -127,9 +248,80 @@ void JitBaseBlockCache::WipeBlockProfilingData(const Core::CPUThreadGuard&)
     if (JitBlock::ProfileData* const profile_data = kv.second.profile_data.get())
       *profile_data = {};
   }
+  m_retired_profile_data.clear();
   Host_JitProfileDataWiped();
 }
 
+void JitBaseBlockCache::WriteFunctionProfile(std::FILE* file) const
+{
+  struct FunctionProfile
+  {
+    u32 address = 0;
+    std::string_view name;
+    u32 num_blocks = 0;
+    u64 run_count = 0;
+    u64 cycles_spent = 0;
+    JitBlock::ProfileData::Clock::duration time_spent = {};
+  };
+
+  // Blocks outside of any known function are listed on their own.
+  std::unordered_map<u32, FunctionProfile> functions;
+  u64 overall_cycles_spent = 0;
+  JitBlock::ProfileData::Clock::duration overall_time_spent = {};
+  const auto add = [&](u32 address, const JitBlock::ProfileData& data) {
+    const Common::Symbol* const symbol = m_jit.m_ppc_symbol_db.GetSymbolFromAddr(address);
+    const u32 function_address = symbol ? symbol->address : address;
+    FunctionProfile& function = functions[function_address];
+    function.address = function_address;
+    if (symbol)
+      function.name = symbol->name;
+    function.num_blocks++;
+    function.run_count += data.run_count;
+    function.cycles_spent += data.cycles_spent;
+    function.time_spent += data.time_spent;
+    overall_cycles_spent += data.cycles_spent;
+    overall_time_spent += data.time_spent;
+  };
+  for (const auto& [physical_address, block] : block_map)
+  {
+    if (block.profile_data)
+      add(block.effectiveAddress, *block.profile_data);
+  }
+  for (const auto& [address, data] : m_retired_profile_data)
+    add(address, data);
+
+  std::vector<const FunctionProfile*> sorted;
+  sorted.reserve(functions.size());
+  for (const auto& [address, function] : functions)
+    sorted.push_back(&function);
+  std::ranges::sort(sorted, std::ranges::greater{},
+                    [](const FunctionProfile* function) { return function->time_spent; });
+
+  fmt::println(file, "address,symbol,blocks,blockRuns,cyclesSpent,cyclesPercent,timeSpent(ns),"
+                     "timePercent");
+  for (const FunctionProfile* function : sorted)
+  {
+    const double cycles_percent = overall_cycles_spent == 0 ?
+                                      double{} :
+                                      100.0 * function->cycles_spent / overall_cycles_spent;
+    const double time_percent =
+        overall_time_spent == JitBlock::ProfileData::Clock::duration{} ?
+            double{} :
+            100.0 * function->time_spent.count() / overall_time_spent.count();
+
+    // CSV escapes quotes by doubling them.
+    std::string name{function->name};
+    for (size_t pos = name.find('"'); pos != std::string::npos; pos = name.find('"', pos + 2))
+      name.insert(pos, 1, '"');
+
+    fmt::println(file, "{:08x},\"{}\",{},{},{},{:.6f},{},{:.6f}", function->address, name,
+                 function->num_blocks, function->run_count, function->cycles_spent,
+                 cycles_percent,
+                 std::chrono::duration_cast<std::chrono::nanoseconds>(function->time_spent).count(),
+                 time_percent);
+  }
+}
+
 JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address)
 {
   const u32 physical_address = m_jit.m_mmu.JitCache_TranslateAddress(em_address).address;
@@ -161,6 +353,7 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
   block.physical_addresses = code_block.m_physical_addresses;
 
   block.originalSize = code_block.m_num_instructions;
+  block.code_hash = JitWarmStartCache::HashCode(code_buffer, block.originalSize);
   if (m_jit.IsDebuggingEnabled())
   {
     // TODO C++23: Can do this all in one statement with `std::vector::assign_range`.
@@ -172,16 +365,16 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
   }
 
   for (u32 addr : block.physical_addresses)
-  {
     valid_block.Set(addr / 32);
-    block_range_map[addr & BLOCK_RANGE_MAP_MASK].insert(&block);
-  }
+  block_range_map.Add(&block);
 
   if (block_link)
   {
     for (const auto& e : block.linkData)
     {
-      links_to[e.exitAddress].insert(&block);
+      std::vector<JitBlock*>& sources = links_to[e.exitAddress];
+      if (std::ranges::find(sources, &block) == sources.end())
+        sources.push_back(&block);
     }
 
     LinkBlock(block);
@@ -306,11 +499,16 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
   // Optimization for the case of invalidating a single cache line, which is used by the dcb*
   // instructions. If the valid_block bit for that cacheline is not set, we can safely skip
   // the remaining invalidation logic.
+  m_invalidation_stats.num_invalidations++;
+
   bool destroy_block = true;
   if (length == 32 && (physical_address & 0x1fu) == 0)
   {
     if (!valid_block.Test(physical_address / 32))
+    {
       destroy_block = false;
+      m_invalidation_stats.num_skipped++;
+    }
     else
       valid_block.Clear(physical_address / 32);
   }
@@ -341,56 +539,35 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
         m_jit.js.fifoWriteAddresses.erase(i);
         m_jit.js.pairedQuantizeAddresses.erase(i);
         m_jit.js.noSpeculativeConstantsAddresses.erase(i);
+        m_jit.js.superblockBranchAddresses.erase(i);
       }
+
+      // New code may have been loaded, so cached blocks that didn't match before might now.
+      m_jit.RetryWarmStartBlocks();
     }
   }
 }
 
 void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
 {
-  // Iterate over all macro blocks which overlap the given range.
-  auto start = block_range_map.lower_bound(address & BLOCK_RANGE_MAP_MASK);
-  auto end = block_range_map.lower_bound(address + length);
-  while (start != end)
+  m_erased_blocks.clear();
+  block_range_map.GetOverlappingBlocks(address, length, &m_erased_blocks);
+  m_invalidation_stats.num_blocks_erased += static_cast<u32>(m_erased_blocks.size());
+
+  for (JitBlock* block : m_erased_blocks)
   {
-    // Iterate over all blocks in the macro block.
-    auto iter = start->second.begin();
-    while (iter != start->second.end())
+    block_range_map.Remove(block);
+    DestroyBlock(*block);
+    auto block_map_iter = block_map.equal_range(block->physicalAddress);
+    while (block_map_iter.first != block_map_iter.second)
     {
-      JitBlock* block = *iter;
-      if (block->OverlapsPhysicalRange(address, length))
+      if (&block_map_iter.first->second == block)
       {
-        // If the block overlaps, also remove all other occupied slots in the other macro blocks.
-        // This will leak empty macro blocks, but they may be reused or cleared later on.
-        for (u32 addr : block->physical_addresses)
-          if ((addr & BLOCK_RANGE_MAP_MASK) != start->first)
-            block_range_map[addr & BLOCK_RANGE_MAP_MASK].erase(block);
-
-        // And remove the block.
-        DestroyBlock(*block);
-        auto block_map_iter = block_map.equal_range(block->physicalAddress);
-        while (block_map_iter.first != block_map_iter.second)
-        {
-          if (&block_map_iter.first->second == block)
-          {
-            block_map.erase(block_map_iter.first);
-            break;
-          }
-          block_map_iter.first++;
-        }
-        iter = start->second.erase(iter);
-      }
-      else
-      {
-        iter++;
+        block_map.erase(block_map_iter.first);
+        break;
       }
+      block_map_iter.first++;
     }
-
-    // If the macro block is empty, drop it.
-    if (start->second.empty())
-      start = block_range_map.erase(start);
-    else
-      start++;
   }
 }
 
@@ -404,8 +581,7 @@ void JitBaseBlockCache::EraseSingleBlock(const JitBlock& block)
 
   JitBlock& mutable_block = block_map_iter->second;
 
-  for (const u32 addr : mutable_block.physical_addresses)
-    block_range_map[addr & BLOCK_RANGE_MAP_MASK].erase(&mutable_block);
+  block_range_map.Remove(&mutable_block);
 
   DestroyBlock(mutable_block);
   block_map.erase(block_map_iter);  // The original JitBlock reference is now dangling.
@@ -416,6 +592,12 @@ u32* JitBaseBlockCache::GetBlockBitSet() const
   return valid_block.m_valid_block.get();
 }
 
+void JitBaseBlockCache::OnFrameEnd()
+{
+  m_last_frame_invalidation_stats = m_invalidation_stats;
+  m_invalidation_stats = {};
+}
+
 void JitBaseBlockCache::WriteDestroyBlock(const JitBlock& block)
 {
 }
@@ -501,6 +683,14 @@ void JitBaseBlockCache::DestroyBlock(JitBlock& block)
     }
   }
 
+  if (const JitBlock::ProfileData* const data = block.profile_data.get(); data && data->run_count)
+  {
+    JitBlock::ProfileData& retired = m_retired_profile_data[block.effectiveAddress];
+    retired.run_count += data->run_count;
+    retired.cycles_spent += data->cycles_spent;
+    retired.time_spent += data->time_spent;
+  }
+
   UnlinkBlock(block);
 
   // Delete linking addresses
@@ -509,9 +699,12 @@ void JitBaseBlockCache::DestroyBlock(JitBlock& block)
     auto it = links_to.find(e.exitAddress);
     if (it == links_to.end())
       continue;
-    it->second.erase(&block);
-    if (it->second.empty())
-      links_to.erase(it);
+    std::vector<JitBlock*>& sources = it->second;
+    const auto source = std::ranges::find(sources, &block);
+    if (source == sources.end())
+      continue;
+    *source = sources.back();
+    sources.pop_back();
   }
 
   // Raise an signal if we are going to call this block again
@@ -6,6 +6,7 @@
 #include <array>
 #include <bitset>
 #include <chrono>
+#include <cstdio>
 #include <cstring>
 #include <functional>
 #include <map>
@@ -19,6 +20,7 @@
 #include "Common/CommonTypes.h"
 #include "Core/HW/Memmap.h"
 #include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/JitCommon/JitWarmStartCache.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 
 class JitBase;
@@ -100,8 +102,11 @@ struct JitBlock : public JitBlockData
   };
   std::vector<LinkData> linkData;
 
-  // This set stores all physical addresses of all occupied instructions.
-  std::set<u32> physical_addresses;
+  // The physical addresses of all occupied instructions, sorted and without duplicates.
+  std::vector<u32> physical_addresses;
+
+  // Hash of the instructions this block was compiled from, see JitWarmStartCache::HashCode.
+  u64 code_hash = 0;
 
   // This is only available when debugging is enabled. It is a trimmed-down copy of the
   // PPCAnalyst::CodeBuffer used to recompile this block, including repeat instructions.
@@ -142,6 +147,52 @@ public:
   bool Test(u32 bit) const { return (m_valid_block[bit / 32] & (1u << (bit % 32))) != 0; }
 };
 
+// Indexes blocks by the 0x100 byte physical ranges their instructions occupy. This is used to
+// find the blocks overlapping an invalidated region.
+//
+// The upper bits of the range number select a lazily allocated leaf covering 1 MiB of physical
+// memory. Each leaf has an occupancy bitmap, so large invalidations only have to scan the bitmap,
+// and a flat list of blocks per range, which rarely holds more than a few entries.
+class BlockRangeMap final
+{
+public:
+  static constexpr u32 RANGE_SHIFT = 8;
+
+  BlockRangeMap();
+  ~BlockRangeMap();
+
+  void Add(JitBlock* block);
+  void Remove(const JitBlock* block);
+  void Clear();
+
+  // Appends every block overlapping [address, address + length) to blocks, each one only once.
+  void GetOverlappingBlocks(u32 address, u32 length, std::vector<JitBlock*>* blocks) const;
+
+private:
+  static constexpr u32 LEAF_SHIFT = 12;
+  static constexpr u32 LEAF_SIZE = 1u << LEAF_SHIFT;
+  static constexpr u32 LEAF_MASK = LEAF_SIZE - 1;
+  static constexpr u32 NUM_LEAVES = 1u << (32 - RANGE_SHIFT - LEAF_SHIFT);
+
+  struct Leaf
+  {
+    std::array<u64, LEAF_SIZE / 64> occupied{};
+    std::array<std::vector<JitBlock*>, LEAF_SIZE> blocks;
+  };
+
+  std::array<std::unique_ptr<Leaf>, NUM_LEAVES> m_leaves;
+};
+
+// Counters for the work done by icache invalidations, reset at the end of every frame.
+struct JitInvalidationStatistics
+{
+  // Calls that reached the block cache.
+  u32 num_invalidations = 0;
+  // Single cache line invalidations that were skipped because no block occupied the line.
+  u32 num_skipped = 0;
+  u32 num_blocks_erased = 0;
+};
+
 class JitBaseBlockCache
 {
 public:
@@ -165,6 +216,10 @@ public:
   void RunOnBlocks(const Core::CPUThreadGuard& guard, std::function<void(const JitBlock&)> f) const;
   void WipeBlockProfilingData(const Core::CPUThreadGuard& guard);
   std::size_t GetBlockCount() const { return block_map.size(); }
+  // Writes the profiling data of all blocks, including destroyed ones, summed up per guest function
+  // as CSV.
+  void WriteFunctionProfile(std::FILE* file) const;
+  std::vector<JitWarmStartCache::Entry> GetWarmStartEntries() const;
 
   JitBlock* AllocateBlock(u32 em_address);
   void FinalizeBlock(JitBlock& block, bool block_link, const PPCAnalyst::CodeBlock& code_block,
@@ -188,6 +243,12 @@ public:
 
   u32* GetBlockBitSet() const;
 
+  void OnFrameEnd();
+  const JitInvalidationStatistics& GetLastFrameInvalidationStatistics() const
+  {
+    return m_last_frame_invalidation_stats;
+  }
+
 protected:
   virtual void DestroyBlock(JitBlock& block);
 
@@ -209,17 +270,27 @@ private:
 
   // links_to hold all exit points of all valid blocks in a reverse way.
   // It is used to query all blocks which links to an address.
-  std::unordered_map<u32, std::unordered_set<JitBlock*>> links_to;  // destination_PC -> number
+  // Lists that become empty are kept around until the next Clear, as the same exits tend to be
+  // linked again once the invalidated code has been recompiled.
+  std::unordered_map<u32, std::vector<JitBlock*>> links_to;  // destination_PC -> sources
 
   // Map indexed by the physical address of the entry point.
   // This is used to query the block based on the current PC in a slow way.
   std::multimap<u32, JitBlock> block_map;  // start_addr -> block
 
-  // Range of overlapping code indexed by a masked physical address.
-  // This is used for invalidation of memory regions. The range is grouped
-  // in macro blocks of each 0x100 bytes.
-  static constexpr u32 BLOCK_RANGE_MAP_MASK = ~(0x100 - 1);
-  std::map<u32, std::unordered_set<JitBlock*>> block_range_map;
+  // Range of overlapping code indexed by physical address.
+  // This is used for invalidation of memory regions.
+  BlockRangeMap block_range_map;
+
+  // Reused by ErasePhysicalRange to avoid an allocation per invalidation.
+  std::vector<JitBlock*> m_erased_blocks;
+
+  // Profiling data of destroyed blocks by effective address, so that the function profile also
+  // covers code that has been invalidated or recompiled since.
+  std::unordered_map<u32, JitBlock::ProfileData> m_retired_profile_data;
+
+  JitInvalidationStatistics m_invalidation_stats;
+  JitInvalidationStatistics m_last_frame_invalidation_stats;
 
   // This bitsets shows which cachelines overlap with any blocks.
   // It is used to provide a fast way to query if no icache invalidation is needed.
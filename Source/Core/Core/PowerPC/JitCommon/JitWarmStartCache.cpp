@@ -0,0 +1,120 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/JitCommon/JitWarmStartCache.h"
+
+#include <algorithm>
+#include <set>
+#include <utility>
+
+#include <xxhash.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+
+namespace
+{
+constexpr u32 WARM_START_CACHE_MAGIC = 0x5754494A;  // JITW
+constexpr u32 WARM_START_CACHE_VERSION = 2;
+constexpr size_t WARM_START_CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
+// Keeps the file (and the time spent validating it on boot) bounded for games with a lot of code.
+constexpr size_t MAX_WARM_START_ENTRIES = 0x10000;
+}  // namespace
+
+u64 JitWarmStartCache::HashCode(const PPCAnalyst::CodeBuffer& code_buffer, u32 num_instructions)
+{
+  std::vector<u32> words;
+  words.reserve(num_instructions * 2);
+  for (u32 i = 0; i < num_instructions; ++i)
+  {
+    words.push_back(code_buffer[i].address);
+    words.push_back(code_buffer[i].inst.hex);
+  }
+  // The hash is stored on disk, so it must not depend on which hash function the host CPU supports
+  return XXH3_64bits(words.data(), words.size() * sizeof(u32));
+}
+
+void JitWarmStartCache::Load(const std::string& game_id)
+{
+  Clear();
+  m_loaded = true;
+  if (game_id.empty())
+    return;
+
+  m_path = File::GetUserPath(D_CACHE_IDX) + game_id + ".jitcache";
+
+  File::IOFile file(m_path, "rb");
+  u32 magic;
+  u32 version;
+  if (!file.ReadBytes(&magic, sizeof(magic)) || !file.ReadBytes(&version, sizeof(version)) ||
+      magic != WARM_START_CACHE_MAGIC || version != WARM_START_CACHE_VERSION)
+  {
+    return;
+  }
+
+  // A truncated trailing entry means the file was not written completely, so don't trust it.
+  const u64 data_size = file.GetSize() - WARM_START_CACHE_HEADER_SIZE;
+  if (data_size % sizeof(Entry) != 0)
+    return;
+
+  m_pending.resize(std::min<size_t>(data_size / sizeof(Entry), MAX_WARM_START_ENTRIES));
+  if (!file.ReadArray(m_pending.data(), m_pending.size()))
+  {
+    m_pending.clear();
+    return;
+  }
+
+  m_retry = true;
+  INFO_LOG_FMT(DYNA_REC, "Read {} warm start blocks from {}", m_pending.size(), m_path);
+}
+
+void JitWarmStartCache::Save(const std::vector<Entry>& compiled_entries)
+{
+  if (m_path.empty())
+    return;
+
+  std::vector<Entry> entries;
+  entries.reserve(std::min(compiled_entries.size() + m_pending.size(), MAX_WARM_START_ENTRIES));
+
+  std::set<std::pair<u32, u32>> seen;
+  const auto add_entries = [&](const std::vector<Entry>& list, u32 failed_validations) {
+    for (Entry entry : list)
+    {
+      if (entries.size() == MAX_WARM_START_ENTRIES)
+        break;
+      entry.failed_validations += failed_validations;
+      if (entry.failed_validations >= MAX_FAILED_VALIDATIONS)
+        continue;
+      if (seen.emplace(entry.effective_address, entry.feature_flags).second)
+        entries.push_back(entry);
+    }
+  };
+  add_entries(compiled_entries, 0);
+  // A run that never compiled an entry counts as one failed validation, no matter how often the
+  // entry was checked during the run
+  add_entries(m_pending, 1);
+
+  File::IOFile file(m_path, "wb");
+  if (!file.WriteBytes(&WARM_START_CACHE_MAGIC, sizeof(WARM_START_CACHE_MAGIC)) ||
+      !file.WriteBytes(&WARM_START_CACHE_VERSION, sizeof(WARM_START_CACHE_VERSION)) ||
+      !file.WriteArray(entries.data(), entries.size()))
+  {
+    WARN_LOG_FMT(DYNA_REC, "Failed to write warm start cache {}", m_path);
+    file.Close();
+    File::Delete(m_path);
+    return;
+  }
+
+  INFO_LOG_FMT(DYNA_REC, "Wrote {} warm start blocks to {}", entries.size(), m_path);
+}
+
+void JitWarmStartCache::Clear()
+{
+  m_path.clear();
+  m_pending.clear();
+  m_loaded = false;
+  m_retry = false;
+  m_invalidations_since_retry = 0;
+}
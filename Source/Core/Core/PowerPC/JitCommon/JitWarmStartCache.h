@@ -0,0 +1,72 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/PowerPC/PPCAnalyst.h"
+
+// Remembers which blocks a game had compiled when emulation last stopped, so that they can be
+// compiled ahead of time on the next boot instead of on the first dispatcher miss.
+//
+// Each entry stores a hash of the analyzed instructions. An entry is only used once analyzing the
+// live memory at its address produces the same hash, so stale entries (for example for code that
+// has not been loaded yet, or that belongs to another REL) are never compiled.
+class JitWarmStartCache
+{
+public:
+  struct Entry
+  {
+    u32 effective_address;
+    u32 feature_flags;
+    u32 num_instructions;
+    // How many runs in a row ended without the entry having been compiled. Blocks that were
+    // compiled during the last run start at 0.
+    u32 failed_validations;
+    u64 code_hash;
+  };
+  static_assert(sizeof(Entry) == 24);
+
+  // Entries are dropped when saving once this many runs have failed to validate them, so that
+  // entries for code that never comes back (for instance superblocks that are analyzed
+  // differently) expire.
+  static constexpr u32 MAX_FAILED_VALIDATIONS = 16;
+
+  // Hashes the addresses and encodings of the first num_instructions ops of an analyzed block.
+  static u64 HashCode(const PPCAnalyst::CodeBuffer& code_buffer, u32 num_instructions);
+
+  void Load(const std::string& game_id);
+  // Writes the given entries, followed by the pending entries that were never compiled.
+  void Save(const std::vector<Entry>& compiled_entries);
+  void Clear();
+
+  bool IsLoaded() const { return m_loaded; }
+
+  // Pending entries are only rescanned after new code may have appeared in memory. Loading code
+  // usually invalidates many cache lines in a row, so only every RETRY_INTERVAL-th invalidation
+  // requests a rescan.
+  bool ShouldRetry() const { return m_retry && !m_pending.empty(); }
+  void OnCodeInvalidated()
+  {
+    if (++m_invalidations_since_retry >= RETRY_INTERVAL)
+    {
+      m_invalidations_since_retry = 0;
+      m_retry = true;
+    }
+  }
+  void FinishRetry() { m_retry = false; }
+
+  std::vector<Entry>& GetPendingEntries() { return m_pending; }
+
+private:
+  static constexpr u32 RETRY_INTERVAL = 256;
+
+  std::string m_path;
+  std::vector<Entry> m_pending;
+  bool m_loaded = false;
+  bool m_retry = false;
+  u32 m_invalidations_since_retry = 0;
+};
@@ -12,9 +12,15 @@
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
 #include "Core/Core.h"
+#include "Core/HW/Memmap.h"
 #include "Core/PowerPC/CPUCoreBase.h"
 #include "Core/PowerPC/CachedInterpreter/CachedInterpreter.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
@@ -202,6 +208,19 @@ std::size_t JitInterface::GetBlockCount() const
   return 0;
 }
 
+JitInvalidationStatistics JitInterface::GetLastFrameInvalidationStatistics() const
+{
+  if (m_jit)
+    return m_jit->GetBlockCache()->GetLastFrameInvalidationStatistics();
+  return {};
+}
+
+void JitInterface::OnFrameEnd()
+{
+  if (m_jit)
+    m_jit->GetBlockCache()->OnFrameEnd();
+}
+
 bool JitInterface::HandleFault(uintptr_t access_address, SContext* ctx)
 {
   // Prevent nullptr dereference on a crash with no JIT present
@@ -210,7 +229,21 @@ bool JitInterface::HandleFault(uintptr_t access_address, SContext* ctx)
     return false;
   }
 
-  return m_jit->HandleFault(access_address, ctx);
+  // A fault on a page table translated address may only mean that the page isn't mapped yet.
+  auto& memory = m_system.GetMemory();
+  const uintptr_t logical_base = reinterpret_cast<uintptr_t>(memory.GetLogicalBase());
+  auto& mmu = m_system.GetMMU();
+  if (logical_base && access_address >= logical_base &&
+      access_address - logical_base < 0x1'0000'0000 && m_system.GetPPCState().msr.DR &&
+      mmu.HandlePageTableFastmemFault(static_cast<u32>(access_address - logical_base)))
+  {
+    return true;
+  }
+
+  const bool handled = m_jit->HandleFault(access_address, ctx);
+  if (handled && memory.IsAddressInFastmemArea(reinterpret_cast<u8*>(access_address)))
+    mmu.CountBackpatch();
+  return handled;
 }
 
 bool JitInterface::HandleStackFault()
@@ -347,10 +380,30 @@ void JitInterface::CompileExceptionCheckFromJIT(JitInterface& jit_interface, Exc
   jit_interface.CompileExceptionCheck(type);
 }
 
+void JitInterface::WriteFunctionProfile() const
+{
+  const std::string filename = fmt::format("{}{}_functions.csv",
+                                           File::GetUserPath(D_DUMPDEBUG_JITBLOCKS_IDX),
+                                           SConfig::GetInstance().GetGameID());
+  File::CreateFullPath(filename);
+  File::IOFile file(filename, "w");
+  if (!file)
+  {
+    WARN_LOG_FMT(DYNA_REC, "Failed to open {} for writing", filename);
+    return;
+  }
+
+  m_jit->GetBlockCache()->WriteFunctionProfile(file.GetHandle());
+  NOTICE_LOG_FMT(DYNA_REC, "Wrote JIT function profile to {}", filename);
+}
+
 void JitInterface::Shutdown()
 {
   if (m_jit)
   {
+    // The CPU thread has stopped, so the blocks can be read without pausing it.
+    if (m_jit->IsProfilingEnabled() && Config::Get(Config::MAIN_DEBUG_JIT_WRITE_FUNCTION_PROFILE))
+      WriteFunctionProfile();
     m_jit->Shutdown();
     m_jit.reset();
   }
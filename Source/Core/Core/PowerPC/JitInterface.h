@@ -19,6 +19,7 @@ class CPUCoreBase;
 class PointerWrap;
 class JitBase;
 struct JitBlock;
+struct JitInvalidationStatistics;
 
 namespace Core
 {
@@ -50,6 +51,10 @@ public:
   void WipeBlockProfilingData(const Core::CPUThreadGuard& guard);
   void RunOnBlocks(const Core::CPUThreadGuard& guard, std::function<void(const JitBlock&)> f) const;
   std::size_t GetBlockCount() const;
+  JitInvalidationStatistics GetLastFrameInvalidationStatistics() const;
+
+  // Called by the CPU thread at the end of every field.
+  void OnFrameEnd();
 
   // Memory Utilities
   bool HandleFault(uintptr_t access_address, SContext* ctx);
@@ -98,6 +103,8 @@ public:
   void Shutdown();
 
 private:
+  void WriteFunctionProfile() const;
+
   std::unique_ptr<JitBase> m_jit;
   Core::System& m_system;
 };
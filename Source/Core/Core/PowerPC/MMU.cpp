@@ -1390,31 +1390,112 @@ static TLBLookupResult LookupTLBPageAddress(PowerPC::PowerPCState& ppc_state,
   return TLBLookupResult::NotFound;
 }
 
-static void UpdateTLBEntry(PowerPC::PowerPCState& ppc_state, const XCheckTLBFlag flag, UPTE_Hi pte2,
-                           const u32 address, const u32 vsid)
+// Returns the tag of the entry that was replaced, or TLBEntry::INVALID_TAG.
+static u32 UpdateTLBEntry(PowerPC::PowerPCState& ppc_state, const XCheckTLBFlag flag, UPTE_Hi pte2,
+                          const u32 address, const u32 vsid)
 {
   if (IsNoExceptionFlag(flag))
-    return;
+    return TLBEntry::INVALID_TAG;
 
   const u32 tag = address >> HW_PAGE_INDEX_SHIFT;
   const size_t tlb_index = IsOpcodeFlag(flag) ? PowerPC::INST_TLB_INDEX : PowerPC::DATA_TLB_INDEX;
   TLBEntry& tlbe = ppc_state.tlb[tlb_index][tag & HW_PAGE_INDEX_MASK];
   const u32 index = tlbe.recent == 0 && tlbe.tag[0] != TLBEntry::INVALID_TAG;
   tlbe.recent = index;
+  const u32 evicted_tag = tlbe.tag[index];
   tlbe.paddr[index] = pte2.RPN << HW_PAGE_INDEX_SHIFT;
   tlbe.pte[index] = pte2.Hex;
   tlbe.tag[index] = tag;
   tlbe.vsid[index] = vsid;
+  return evicted_tag;
 }
 
 void MMU::InvalidateTLBEntry(u32 address)
 {
   const u32 entry_index = (address >> HW_PAGE_INDEX_SHIFT) & HW_PAGE_INDEX_MASK;
 
+  if (m_memory.IsPageTableMappingEnabled())
+  {
+    for (const u32 tag : m_ppc_state.tlb[PowerPC::DATA_TLB_INDEX][entry_index].tag)
+    {
+      if (tag != TLBEntry::INVALID_TAG)
+        m_memory.RemovePageTableMapping(tag << HW_PAGE_INDEX_SHIFT);
+    }
+  }
+
   m_ppc_state.tlb[PowerPC::DATA_TLB_INDEX][entry_index].Invalidate();
   m_ppc_state.tlb[PowerPC::INST_TLB_INDEX][entry_index].Invalidate();
 }
 
+void MMU::SRUpdated(u32 index)
+{
+  // The VSID of every translation in this segment may have changed.
+  if (m_memory.IsPageTableMappingEnabled())
+    m_memory.RemovePageTableMappings(index << 28, 0x10000000);
+}
+
+bool MMU::HandlePageTableFastmemFault(u32 effective_address)
+{
+  if (!m_memory.IsPageTableMappingEnabled() || !m_ppc_state.msr.DR ||
+      m_ppc_state.m_enable_dcache)
+  {
+    return false;
+  }
+
+  const u32 page_address = effective_address & ~static_cast<u32>(HW_PAGE_MASK);
+
+  // Fast accesses don't support memchecks, so pages with memchecks on them are never mapped.
+  if (m_power_pc.GetMemChecks().OverlapsMemcheck(page_address, HW_PAGE_SIZE))
+    return false;
+
+  bool write = false;
+  if (const Memory::PageTableMapping* mapping = m_memory.GetPageTableMapping(page_address))
+  {
+    // The page is already mapped, so this must have been a write to a page that isn't writeable
+    // yet. Any other fault is left to the JIT.
+    if (mapping->writeable)
+      return false;
+    write = true;
+  }
+
+  // Translating has the same side effects on the TLB and the R and C bits as the access itself
+  // would have had.
+  const TranslateAddressResult result =
+      write ? TranslateAddress<XCheckTLBFlag::Write>(effective_address) :
+              TranslateAddress<XCheckTLBFlag::Read>(effective_address);
+  if (result.result != TranslateAddressResultEnum::PAGE_TABLE_TRANSLATED || result.wi)
+    return false;
+
+  // The way must be matched the same way LookupTLBPageAddress does, or an entry for the same
+  // page of another segment could supply the C bit.
+  const u32 tag = effective_address >> HW_PAGE_INDEX_SHIFT;
+  const u32 vsid = UReg_SR{m_ppc_state.sr[EffectiveAddress{effective_address}.SR]}.VSID;
+  const TLBEntry& tlbe = m_ppc_state.tlb[PowerPC::DATA_TLB_INDEX][tag & HW_PAGE_INDEX_MASK];
+  u32 way;
+  if (tlbe.tag[0] == tag && tlbe.vsid[0] == vsid)
+    way = 0;
+  else if (tlbe.tag[1] == tag && tlbe.vsid[1] == vsid)
+    way = 1;
+  else
+    return false;
+
+  const bool writeable = UPTE_Hi{tlbe.pte[way]}.C != 0;
+  if (!m_memory.AddPageTableMapping(page_address, result.address & ~static_cast<u32>(HW_PAGE_MASK),
+                                    writeable))
+  {
+    return false;
+  }
+
+  m_tlb_statistics.page_table_mappings++;
+  return true;
+}
+
+void MMU::OnFrameEnd()
+{
+  m_last_frame_tlb_statistics = m_tlb_statistics;
+  m_tlb_statistics = {};
+}
+
 // Page Address Translation
 template <const XCheckTLBFlag flag>
 MMU::TranslateAddressResult MMU::TranslatePageAddress(const EffectiveAddress address, bool* wi)
@@ -1428,6 +1509,14 @@ MMU::TranslateAddressResult MMU::TranslatePageAddress(const EffectiveAddress add
   u32 translated_address = 0;
   const TLBLookupResult res =
       LookupTLBPageAddress(m_ppc_state, flag, address.Hex, VSID, &translated_address, wi);
+  if constexpr (!IsNoExceptionFlag(flag))
+  {
+    if (res == TLBLookupResult::NotFound)
+      m_tlb_statistics.tlb_misses++;
+    else
+      m_tlb_statistics.tlb_hits++;
+  }
+
   if (res == TLBLookupResult::Found)
   {
     return TranslateAddressResult{TranslateAddressResultEnum::PAGE_TABLE_TRANSLATED,
@@ -1503,7 +1592,14 @@ MMU::TranslateAddressResult MMU::TranslatePageAddress(const EffectiveAddress add
 
         // We already updated the TLB entry if this was caused by a C bit.
         if (res != TLBLookupResult::UpdateC)
-          UpdateTLBEntry(m_ppc_state, flag, pte2, address.Hex, VSID);
+        {
+          const u32 evicted_tag = UpdateTLBEntry(m_ppc_state, flag, pte2, address.Hex, VSID);
+          if (flag != XCheckTLBFlag::Opcode && evicted_tag != TLBEntry::INVALID_TAG &&
+              m_memory.IsPageTableMappingEnabled())
+          {
+            m_memory.RemovePageTableMapping(evicted_tag << HW_PAGE_INDEX_SHIFT);
+          }
+        }
 
         *wi = (pte2.WIMG & 0b1100) != 0;
 
@@ -238,10 +238,29 @@ public:
 
   // TLB functions
   void SDRUpdated();
+  void SRUpdated(u32 index);
   void InvalidateTLBEntry(u32 address);
   void DBATUpdated();
   void IBATUpdated();
 
+  // Called when a fastmem access to an address that isn't BAT mapped faults. If the address is
+  // translated by a data TLB entry, the page is mapped into the logical fastmem region so that the
+  // access can be retried. A page is only mapped writeable once its C bit is set, so the first
+  // write to a page still goes through this function.
+  bool HandlePageTableFastmemFault(u32 effective_address);
+
+  struct TLBStatistics
+  {
+    u64 tlb_hits = 0;
+    u64 tlb_misses = 0;
+    u64 page_table_mappings = 0;
+    u64 backpatches = 0;
+  };
+
+  void CountBackpatch() { m_tlb_statistics.backpatches++; }
+  void OnFrameEnd();
+  const TLBStatistics& GetLastFrameTLBStatistics() const { return m_last_frame_tlb_statistics; }
+
   // Result changes based on the BAT registers and MSR.DR.  Returns whether
   // it's safe to optimize a read or write to this address to an unguarded
   // memory access.  Does not consider page tables.
@@ -326,6 +345,9 @@ private:
 
   BatTable m_ibat_table;
   BatTable m_dbat_table;
+
+  TLBStatistics m_tlb_statistics;
+  TLBStatistics m_last_frame_tlb_statistics;
 };
 
 void ClearDCacheLineFromJit(MMU& mmu, u32 address);
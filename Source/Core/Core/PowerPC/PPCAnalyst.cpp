@@ -4,7 +4,10 @@
 #include "Core/PowerPC/PPCAnalyst.h"
 
 #include <algorithm>
+#include <array>
+#include <bitset>
 #include <map>
+#include <optional>
 #include <queue>
 #include <string>
 #include <vector>
@@ -19,6 +22,8 @@
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/HLE/HLE.h"
+#include "Core/HW/MMIO.h"
+#include "Core/HW/Memmap.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
@@ -737,54 +742,202 @@ void PPCAnalyzer::SetInstructionStats(CodeBlock* block, CodeOp* code,
   }
 }
 
-bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions) const
+// Returns whether the instruction may appear in a busy wait loop without disqualifying it, as long
+// as its register inputs and outputs also pass the checks in IsBusyWaitLoop.
+static bool CanAppearInBusyWaitLoop(const CodeOp& op)
+{
+  switch (op.opinfo->type)
+  {
+  case OpType::Integer:
+  case OpType::CR:
+  case OpType::Load:
+  case OpType::LoadFP:
+  case OpType::LoadPS:
+  case OpType::Branch:
+    return true;
+  case OpType::DataCache:
+    // Writing back or invalidating a cache line again has no further effect, but dcbz and dcba
+    // write to memory.
+    return op.inst.SUBOP10 != 1014 && op.inst.SUBOP10 != 758;
+  case OpType::InstructionCache:
+    // isync
+    return op.inst.SUBOP10 == 150;
+  case OpType::System:
+    // sync, eieio, mcrf, mfcr and mtcrf. mcrxr is left out since it clears XER.
+    return (op.inst.OPCD == 31 && (op.inst.SUBOP10 == 598 || op.inst.SUBOP10 == 854 ||
+                                   op.inst.SUBOP10 == 19 || op.inst.SUBOP10 == 144)) ||
+           (op.inst.OPCD == 19 && op.inst.SUBOP10 == 0);
+  default:
+    return false;
+  }
+}
+
+// Returns the size in bytes of a plain integer load, or 0 for any other instruction.
+static u32 GetIntegerLoadSize(UGeckoInstruction inst)
+{
+  switch (inst.OPCD)
+  {
+  case 32:  // lwz
+    return 4;
+  case 34:  // lbz
+    return 1;
+  case 40:  // lhz
+  case 42:  // lha
+    return 2;
+  case 31:
+    switch (inst.SUBOP10)
+    {
+    case 23:   // lwzx
+    case 534:  // lwbrx
+      return 4;
+    case 87:  // lbzx
+      return 1;
+    case 279:  // lhzx
+    case 343:  // lhax
+    case 790:  // lhbrx
+      return 2;
+    }
+    break;
+  }
+  return 0;
+}
+
+// Returns whether reading the given address hits an MMIO register whose value changes without a
+// scheduled event or whose reads have side effects.
+static bool IsVolatileMMIORead(Core::System& system, u32 address, u32 size)
+{
+  u32 physical_address = 0;
+  if (system.GetPPCState().msr.DR)
+    physical_address = system.GetMMU().IsOptimizableMMIOAccess(address, size * 8);
+  else if (MMIO::IsMMIOAddress(address, system.IsWii()))
+    physical_address = address;
+
+  return physical_address != 0 &&
+         system.GetMemory().GetMMIOMapping()->IsReadVolatile(physical_address, size);
+}
+
+bool PPCAnalyzer::IsBusyWaitLoop(Core::System& system, CodeBlock* block, CodeOp* code,
+                                 size_t instructions) const
 {
   // Very basic algorithm to detect busy wait loops:
-  //   * It loops to itself and does not contain any other branches.
-  //   * It does not write to memory.
-  //   * It only reads from registers it wrote to earlier in the loop, or it
-  //     does not write to these registers.
+  //   * It loops to itself and does not contain any branches that use CTR.
+  //   * It does not write to memory. Cache maintenance and memory barriers are allowed, since
+  //     executing them again has no further effect.
+  //   * It only reads from registers (GPRs, FPRs, CR fields and CA) it wrote to earlier in the
+  //     loop, or it does not write to these registers.
+  //   * It does not poll an MMIO register whose value changes without a scheduled event, or
+  //     whose reads have side effects. Skipping to the next event would change what such a loop
+  //     observes.
   //
-  // Would benefit a lot from basic inlining support - a lot of the most
-  // used busy loops are DSP register interactions, which are bl/cmp/bne
-  // (with the bl target a pure function that follows the above rules). We
-  // don't detect these at the moment.
+  // Branches out of the loop are fine, as are calls to pure functions when branch following
+  // inlines them. Calls to functions which set up a stack frame write to memory and are not
+  // detected at the moment.
   std::bitset<32> write_disallowed_regs;
   std::bitset<32> written_regs;
+  std::bitset<32> write_disallowed_fregs;
+  std::bitset<32> written_fregs;
+  BitSet8 write_disallowed_crs;
+  BitSet8 written_crs;
+  bool write_disallowed_ca = false;
+  bool written_ca = false;
+
+  // Known values of GPRs, for resolving load addresses. Registers which the loop doesn't write
+  // keep the value they have now. This can be wrong if the block is later entered with other
+  // values, but then it only misses a volatile read, which is what happened before the check.
+  const auto& ppc_state = system.GetPPCState();
+  std::array<std::optional<u32>, 32> values;
+  const auto get_value = [&](u32 reg) -> std::optional<u32> {
+    return written_regs[reg] ? values[reg] : ppc_state.gpr[reg];
+  };
+
   for (size_t i = 0; i <= instructions; ++i)
   {
-    if (code[i].opinfo->type == OpType::Branch)
+    const CodeOp& op = code[i];
+    if (!CanAppearInBusyWaitLoop(op))
+      return false;
+
+    if (op.opinfo->type == OpType::Branch)
     {
-      if (code[i].branchUsesCtr)
+      if (op.branchUsesCtr)
         return false;
-      if (code[i].branchTo == block->m_address && i == instructions)
+      if (op.branchTo == block->m_address && i == instructions)
         return true;
+      write_disallowed_crs |= op.crIn & ~written_crs;
+      continue;
     }
-    else if (code[i].opinfo->type != OpType::Integer && code[i].opinfo->type != OpType::Load)
+
+    if (const u32 load_size = GetIntegerLoadSize(op.inst))
     {
-      // In the future, some subsets of other instruction types might get
-      // supported. Right now, only try loops that have this very
-      // restricted instruction set.
-      return false;
+      std::optional<u32> address = op.inst.RA == 0 ? 0 : get_value(op.inst.RA);
+      if (address)
+      {
+        const std::optional<u32> offset =
+            op.inst.OPCD == 31 ? get_value(op.inst.RB) : u32(s32(op.inst.SIMM_16));
+        address = offset ? std::optional<u32>(*address + *offset) : std::nullopt;
+      }
+      if (address && IsVolatileMMIORead(system, *address, load_size))
+        return false;
     }
-    else
+
+    for (int reg : op.regsIn)
     {
-      for (int reg : code[i].regsIn)
-      {
-        if (reg == -1)
-          continue;
-        if (written_regs[reg])
-          continue;
+      if (!written_regs[reg])
         write_disallowed_regs[reg] = true;
-      }
-      for (int reg : code[i].regsOut)
-      {
-        if (reg == -1)
-          continue;
-        if (write_disallowed_regs[reg])
-          return false;
-        written_regs[reg] = true;
-      }
+    }
+    for (int reg : op.fregsIn)
+    {
+      if (!written_fregs[reg])
+        write_disallowed_fregs[reg] = true;
+    }
+    write_disallowed_crs |= op.crIn & ~written_crs;
+    if (op.wantsCA && !written_ca)
+      write_disallowed_ca = true;
+
+    // Track constants built by li, lis, addi, addis, ori and oris so that MMIO addresses can be
+    // resolved.
+    std::optional<u32> result;
+    switch (op.inst.OPCD)
+    {
+    case 14:  // addi
+    case 15:  // addis
+    {
+      const u32 imm = op.inst.OPCD == 14 ? u32(s32(op.inst.SIMM_16)) : u32(op.inst.UIMM) << 16;
+      const std::optional<u32> base = op.inst.RA == 0 ? 0 : get_value(op.inst.RA);
+      if (base)
+        result = *base + imm;
+      break;
+    }
+    case 24:  // ori
+    case 25:  // oris
+    {
+      const u32 imm = op.inst.OPCD == 24 ? op.inst.UIMM : op.inst.UIMM << 16;
+      if (const std::optional<u32> source = get_value(op.inst.RS))
+        result = *source | imm;
+      break;
+    }
+    }
+
+    for (int reg : op.regsOut)
+    {
+      if (write_disallowed_regs[reg])
+        return false;
+      written_regs[reg] = true;
+      values[reg] = result;
+    }
+    for (int reg : op.GetFregsOut())
+    {
+      if (write_disallowed_fregs[reg])
+        return false;
+      written_fregs[reg] = true;
+    }
+    if (op.crOut & write_disallowed_crs)
+      return false;
+    written_crs |= op.crOut;
+    if (op.outputCA)
+    {
+      if (write_disallowed_ca)
+        return false;
+      written_ca = true;
     }
   }
   return false;
@@ -818,6 +971,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
   block->m_memory_exception = false;
   block->m_num_instructions = 0;
   block->m_gqr_used = BitSet8(0);
+  block->m_gqr_used_before_modified = BitSet8(0);
   block->m_physical_addresses.clear();
 
   CodeOp* const code = buffer->data();
@@ -852,11 +1006,12 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
     code[i].inst = inst;
     code[i].skip = false;
     block->m_stats->numCycles += opinfo->num_cycles;
-    block->m_physical_addresses.insert(result.physical_address);
+    block->m_physical_addresses.push_back(result.physical_address);
 
     SetInstructionStats(block, &code[i], opinfo);
 
     bool follow = false;
+    bool follow_conditional = false;
 
     bool conditional_continue = false;
 
@@ -887,6 +1042,15 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
           caller = i;
         }
       }
+      else if (inst.OPCD == 16 && !inst.LK && m_hot_branches && block_size > 1 &&
+               code[i].branchTo > address && code[i].branchTo != block->m_address &&
+               m_hot_branches->contains(address))
+      {
+        // Follow the taken path of conditional BCX instructions that the JIT profiled as hot.
+        // Only forward branches are considered so that loops still go through block linking.
+        follow = true;
+        follow_conditional = true;
+      }
       else if (inst.OPCD == 19 && inst.SUBOP10 == 16 && !inst.LK && found_call)
       {
         code[i].branchTo = code[caller].address + 4;
@@ -943,13 +1107,19 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
     }
 
     code[i].branchIsIdleLoop =
-        code[i].branchTo == block->m_address && IsBusyWaitLoop(block, code, i);
+        code[i].branchTo == block->m_address && IsBusyWaitLoop(system, block, code, i);
 
     if (follow && numFollows < BRANCH_FOLLOWING_THRESHOLD)
     {
       // Follow the unconditional branch.
       numFollows++;
       address = code[i].branchTo;
+      if (follow_conditional)
+      {
+        code[i].branchIsFollowedConditional = true;
+        // The fall-through path leaves the block, so a later RET can't be matched to its CALL.
+        found_call = false;
+      }
     }
     else
     {
@@ -971,6 +1141,11 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
 
   block->m_num_instructions = num_inst;
 
+  // Followed branches and repeated instructions can visit the same address more than once.
+  std::ranges::sort(block->m_physical_addresses);
+  const auto duplicates = std::ranges::unique(block->m_physical_addresses);
+  block->m_physical_addresses.erase(duplicates.begin(), duplicates.end());
+
   if (block->m_num_instructions > 1)
     ReorderInstructions(block->m_num_instructions, code);
 
@@ -1059,7 +1234,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
 
   // Forward scan, for flags that need the other direction for calculation.
   BitSet32 fprIsSingle, fprIsDuplicated, fprIsStoreSafe;
-  BitSet8 gqrUsed, gqrModified;
+  BitSet8 gqrUsed, gqrModified, gqrUsedBeforeModified;
   for (u32 i = 0; i < block->m_num_instructions; i++)
   {
     CodeOp& op = code[i];
@@ -1140,6 +1315,8 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
     {
       const int gqr = op.inst.OPCD == 4 ? op.inst.Ix : op.inst.I;
       gqrUsed[gqr] = true;
+      if (!gqrModified[gqr])
+        gqrUsedBeforeModified[gqr] = true;
     }
 
     if (IsMtspr(op.inst))
@@ -1151,6 +1328,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
   }
   block->m_gqr_used = gqrUsed;
   block->m_gqr_modified = gqrModified;
+  block->m_gqr_used_before_modified = gqrUsedBeforeModified;
   block->m_gpr_inputs = gprBlockInputs;
   return address;
 }
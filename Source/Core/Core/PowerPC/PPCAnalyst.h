@@ -5,7 +5,7 @@
 
 #include <algorithm>
 #include <cstddef>
-#include <set>
+#include <unordered_set>
 #include <vector>
 
 #include "Common/BitSet.h"
@@ -22,6 +22,7 @@ struct Symbol;
 namespace Core
 {
 class CPUThreadGuard;
+class System;
 }
 
 namespace PPCAnalyst
@@ -40,6 +41,8 @@ struct CodeOp  // 16B
   BitSet8 crOut;
   bool branchUsesCtr = false;
   bool branchIsIdleLoop = false;
+  // Conditional branch whose taken path was inlined; the fall-through path leaves the block.
+  bool branchIsFollowedConditional = false;
   BitSet8 wantsCR;
   bool wantsFPRF = false;
   bool wantsCA = false;
@@ -125,11 +128,14 @@ struct CodeBlock
   // Which GQRs this block modifies, if any.
   BitSet8 m_gqr_modified;
 
+  // Which GQRs this block uses before modifying them, if any.
+  BitSet8 m_gqr_used_before_modified;
+
   // Which GPRs this block reads from before defining, if any.
   BitSet32 m_gpr_inputs;
 
-  // Which memory locations are occupied by this block.
-  std::set<u32> m_physical_addresses;
+  // Which memory locations are occupied by this block, sorted and without duplicates.
+  std::vector<u32> m_physical_addresses;
 };
 
 class PPCAnalyzer
@@ -179,6 +185,12 @@ public:
   bool HasOption(AnalystOption option) const { return !!(m_options & option); }
   void SetDebuggingEnabled(bool enabled) { m_is_debugging_enabled = enabled; }
   void SetBranchFollowingEnabled(bool enabled) { m_enable_branch_following = enabled; }
+  // Addresses of conditional branches whose taken path should be followed like an unconditional
+  // branch. The JIT must support inverted block exits for such branches.
+  void SetHotBranches(const std::unordered_set<u32>* hot_branches)
+  {
+    m_hot_branches = hot_branches;
+  }
   void SetFloatExceptionsEnabled(bool enabled) { m_enable_float_exceptions = enabled; }
   void SetDivByZeroExceptionsEnabled(bool enabled) { m_enable_div_by_zero_exceptions = enabled; }
   u32 Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std::size_t block_size) const;
@@ -196,13 +208,15 @@ private:
                                ReorderType type) const;
   void ReorderInstructions(u32 instructions, CodeOp* code) const;
   void SetInstructionStats(CodeBlock* block, CodeOp* code, const GekkoOPInfo* opinfo) const;
-  bool IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions) const;
+  bool IsBusyWaitLoop(Core::System& system, CodeBlock* block, CodeOp* code,
+                      size_t instructions) const;
 
   // Options
   u32 m_options = 0;
 
   bool m_is_debugging_enabled = false;
   bool m_enable_branch_following = false;
+  const std::unordered_set<u32>* m_hot_branches = nullptr;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
 };
@@ -15,6 +15,7 @@
 #include "Common/MsgHandler.h"
 
 #include "DiscIO/CISOBlob.h"
+#include "DiscIO/ChunkStoreBlob.h"
 #include "DiscIO/CompressedBlob.h"
 #include "DiscIO/DirectoryBlob.h"
 #include "DiscIO/FileBlob.h"
@@ -56,6 +57,8 @@ std::string GetName(BlobType blob_type, bool translate)
     return "NFS";
   case BlobType::SPLIT_PLAIN:
     return translate_str("Multi-part ISO");
+  case BlobType::CHUNK_STORE:
+    return "DCS";
   default:
     return "";
   }
@@ -119,7 +122,14 @@ const SectorReader::Cache* SectorReader::GetCacheLine(u64 block_num)
   u64 chunk_idx = block_num / m_chunk_blocks;
   u32 blocks_read = ReadChunk(cache->data.data(), chunk_idx);
   if (!blocks_read)
-    return nullptr;
+  {
+    // One block that can't be read fails the whole chunk. Fall back to reading only the wanted
+    // block, so that the readable blocks of the chunk can still be accessed.
+    if (m_chunk_blocks == 1 || !GetBlock(block_num, cache->data.data()))
+      return nullptr;
+    cache->Fill(block_num, 1);
+    return cache;
+  }
   cache->Fill(chunk_idx * m_chunk_blocks, blocks_read);
 
   // Secondary check for out-of-bounds read.
@@ -242,6 +252,8 @@ std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename)
     return RVZFileReader::Create(std::move(file), filename);
   case NFS_MAGIC:
     return NFSFileReader::Create(std::move(file), filename);
+  case CHUNK_STORE_MAGIC:
+    return ChunkStoreFileReader::Create(std::move(file), filename);
   default:
     if (auto directory_blob = DirectoryBlobReader::Create(filename))
       return std::move(directory_blob);
@@ -42,6 +42,7 @@ enum class BlobType
   MOD_DESCRIPTOR,
   NFS,
   SPLIT_PLAIN,
+  CHUNK_STORE,
 };
 
 // If you convert an ISO file to another format and then call GetDataSize on it, what is the result?
@@ -58,6 +59,22 @@ enum class DataSizeType
 
 std::string GetName(BlobType blob_type, bool translate);
 
+struct BlobCacheStatistics
+{
+  // Reads that were served by data which was already decompressed.
+  u64 hits = 0;
+  // Reads that were served by data which was decompressed ahead of time on another thread.
+  u64 read_ahead_hits = 0;
+  // Reads that had to wait for data to be decompressed on demand.
+  u64 misses = 0;
+
+  // Wii groups that were served by the encryption cache, and groups that had to be encrypted and
+  // hashed. Thrashes are misses for groups that had been evicted from the cache shortly before.
+  u64 encrypted_group_hits = 0;
+  u64 encrypted_group_misses = 0;
+  u64 encrypted_group_thrashes = 0;
+};
+
 class BlobReader
 {
 public:
@@ -76,6 +93,9 @@ public:
   virtual std::string GetCompressionMethod() const = 0;
   virtual std::optional<int> GetCompressionLevel() const = 0;
 
+  // Returns nullopt for formats that don't cache decompressed data. Thread-safe.
+  virtual std::optional<BlobCacheStatistics> GetCacheStatistics() const { return std::nullopt; }
+
   // NOT thread-safe - can't call this from multiple threads.
   virtual bool Read(u64 offset, u64 size, u8* out_ptr) = 0;
   template <typename T>
@@ -87,6 +107,11 @@ public:
     return Common::FromBigEndian(temp);
   }
 
+  // Returns a pointer to the data if the whole range can be accessed directly in memory (for
+  // instance because the file is memory mapped), or nullptr otherwise. The pointer stays valid
+  // for as long as the reader exists. Thread-safe.
+  virtual const u8* GetMappedData(u64 offset, u64 size) const { return nullptr; }
+
   virtual bool SupportsReadWiiDecrypted(u64 offset, u64 size, u64 partition_data_offset) const
   {
     return false;
@@ -194,14 +219,30 @@ std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename);
 
 using CompressCB = std::function<bool(const std::string& text, float percent)>;
 
+// Resource limits for a single conversion. Zero means that no limit is set.
+struct ConversionLimits
+{
+  // Number of compression threads. Defaults to one per hardware thread.
+  unsigned int threads = 0;
+  // Approximate upper bound in bytes for the data buffered by the compression threads and the
+  // input read-ahead. Fewer compression threads are used if needed to stay below it.
+  u64 memory = 0;
+};
+
 bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
                   const std::string& outfile_path, u32 sub_type, int sector_size,
-                  const CompressCB& callback);
+                  const CompressCB& callback, const ConversionLimits& limits = {});
 bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
                     const std::string& outfile_path, const CompressCB& callback);
 bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
-                       int chunk_size, const CompressCB& callback);
+                       int chunk_size, const CompressCB& callback,
+                       const ConversionLimits& limits = {});
+// Adds the chunks of infile that aren't stored yet to the chunk store in the folder of
+// outfile_path, and writes outfile_path as a disc image file that refers to them.
+bool ConvertToChunkStore(BlobReader* infile, const std::string& infile_path,
+                         const std::string& outfile_path, int chunk_size, int compression_level,
+                         const CompressCB& callback);
 
 }  // namespace DiscIO
@@ -0,0 +1,535 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DiscIO/ChunkStoreBlob.h"
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <zstd.h>
+
+#include "Common/Assert.h"
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/MsgHandler.h"
+#include "Common/StringUtil.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/DiscUtils.h"
+#include "DiscIO/MultithreadedCompressor.h"
+
+namespace DiscIO
+{
+namespace
+{
+// Decompressed chunks shared by all chunk store readers in the process. Chunks are keyed by their
+// hash, so disc images that share chunks also share the memory for them, and so does opening the
+// same disc image several times (for instance for the game list and for emulation).
+class SharedChunkCache
+{
+public:
+  std::shared_ptr<const std::vector<u8>> Get(const Common::SHA1::Digest& hash)
+  {
+    std::lock_guard lk(m_mutex);
+    const auto it = m_index.find(hash);
+    if (it == m_index.end())
+      return nullptr;
+
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return it->second->data;
+  }
+
+  void Insert(const Common::SHA1::Digest& hash, std::shared_ptr<const std::vector<u8>> data)
+  {
+    std::lock_guard lk(m_mutex);
+    if (m_index.contains(hash))
+      return;
+
+    m_size += data->size();
+    m_entries.push_front(Entry{hash, std::move(data)});
+    m_index.emplace(hash, m_entries.begin());
+
+    while (m_size > MAX_SIZE && m_entries.size() > 1)
+    {
+      m_size -= m_entries.back().data->size();
+      m_index.erase(m_entries.back().hash);
+      m_entries.pop_back();
+    }
+  }
+
+private:
+  static constexpr u64 MAX_SIZE = 64 * 1024 * 1024;
+
+  struct Entry
+  {
+    Common::SHA1::Digest hash;
+    std::shared_ptr<const std::vector<u8>> data;
+  };
+
+  std::mutex m_mutex;
+  // Most recently used first
+  std::list<Entry> m_entries;
+  std::map<Common::SHA1::Digest, std::list<Entry>::iterator> m_index;
+  u64 m_size = 0;
+};
+
+SharedChunkCache& GetSharedChunkCache()
+{
+  static SharedChunkCache cache;
+  return cache;
+}
+
+std::string GetStoreFolder(const std::string& path)
+{
+  std::string folder;
+  SplitPath(path, &folder, nullptr, nullptr);
+  return folder;
+}
+
+u64 GetChunkDataSize(const ChunkStoreHeader& header, u64 chunk_index)
+{
+  return std::min<u64>(header.chunk_size, header.data_size - chunk_index * header.chunk_size);
+}
+}  // namespace
+
+ChunkStoreFileReader::ChunkStoreFileReader(ChunkStoreHeader header,
+                                           std::vector<ChunkStoreEntry> entries,
+                                           File::IOFile pack, std::string path, u64 raw_size)
+    : m_header(header), m_entries(std::move(entries)), m_pack(std::move(pack)),
+      m_path(std::move(path)), m_raw_size(raw_size)
+{
+}
+
+std::unique_ptr<ChunkStoreFileReader> ChunkStoreFileReader::Create(File::IOFile file,
+                                                                   const std::string& path)
+{
+  ChunkStoreHeader header;
+  if (!file.Seek(0, File::SeekOrigin::Begin) || !file.ReadArray(&header, 1))
+    return nullptr;
+
+  // The sizes are checked before anything is allocated based on them
+  if (header.magic != CHUNK_STORE_MAGIC || header.version != CHUNK_STORE_VERSION ||
+      header.chunk_size > static_cast<u32>(CHUNK_STORE_MAX_BLOCK_SIZE) ||
+      !IsDiscImageBlockSizeValid(static_cast<int>(header.chunk_size), BlobType::CHUNK_STORE) ||
+      header.num_chunks != header.data_size / header.chunk_size +
+                               (header.data_size % header.chunk_size != 0) ||
+      header.data_size > u64(header.num_chunks) * header.chunk_size ||
+      file.GetSize() != sizeof(header) + u64(header.num_chunks) * sizeof(ChunkStoreEntry))
+  {
+    return nullptr;
+  }
+
+  std::vector<ChunkStoreEntry> entries(header.num_chunks);
+  if (!file.ReadArray(entries.data(), entries.size()))
+    return nullptr;
+
+  const size_t max_stored_size = ZSTD_compressBound(header.chunk_size);
+  if (std::ranges::any_of(entries, [&](const ChunkStoreEntry& entry) {
+        return entry.stored_size > max_stored_size;
+      }))
+  {
+    ERROR_LOG_FMT(DISCIO, "Chunk store {} contains chunks that are too large", path);
+    return nullptr;
+  }
+
+  const std::string pack_path = GetStoreFolder(path) + CHUNK_STORE_PACK_NAME;
+  File::IOFile pack(pack_path, "rb");
+  if (!pack)
+  {
+    ERROR_LOG_FMT(DISCIO, "Chunk store pack {} for {} could not be opened", pack_path, path);
+    return nullptr;
+  }
+
+  u64 raw_size = file.GetSize();
+  for (const ChunkStoreEntry& entry : entries)
+    raw_size += entry.stored_size;
+
+  return std::unique_ptr<ChunkStoreFileReader>(
+      new ChunkStoreFileReader(header, std::move(entries), std::move(pack), path, raw_size));
+}
+
+std::unique_ptr<BlobReader> ChunkStoreFileReader::CopyReader() const
+{
+  return Create(File::IOFile(m_path, "rb"), m_path);
+}
+
+std::optional<BlobCacheStatistics> ChunkStoreFileReader::GetCacheStatistics() const
+{
+  return BlobCacheStatistics{.hits = m_hits.load(), .misses = m_misses.load()};
+}
+
+bool ChunkStoreFileReader::Read(u64 offset, u64 size, u8* out_ptr)
+{
+  if (offset > m_header.data_size || size > m_header.data_size - offset)
+    return false;
+
+  while (size > 0)
+  {
+    const u64 chunk_index = offset / m_header.chunk_size;
+    const u64 offset_in_chunk = offset % m_header.chunk_size;
+
+    const std::shared_ptr<const std::vector<u8>> chunk = GetChunk(chunk_index);
+    if (!chunk)
+      return false;
+
+    const u64 bytes_to_copy = std::min(size, chunk->size() - offset_in_chunk);
+    std::copy_n(chunk->data() + offset_in_chunk, bytes_to_copy, out_ptr);
+
+    offset += bytes_to_copy;
+    size -= bytes_to_copy;
+    out_ptr += bytes_to_copy;
+  }
+
+  return true;
+}
+
+std::shared_ptr<const std::vector<u8>> ChunkStoreFileReader::GetChunk(u64 chunk_index)
+{
+  if (m_last_chunk && m_last_chunk_index == chunk_index)
+  {
+    ++m_hits;
+    return m_last_chunk;
+  }
+
+  const ChunkStoreEntry& entry = m_entries[chunk_index];
+  std::shared_ptr<const std::vector<u8>> chunk = GetSharedChunkCache().Get(entry.hash);
+  if (chunk)
+  {
+    ++m_hits;
+  }
+  else
+  {
+    ++m_misses;
+
+    const u64 data_size = GetChunkDataSize(m_header, chunk_index);
+    m_read_buffer.resize(entry.stored_size);
+    if (!m_pack.Seek(entry.pack_offset, File::SeekOrigin::Begin) ||
+        !m_pack.ReadBytes(m_read_buffer.data(), m_read_buffer.size()))
+    {
+      ERROR_LOG_FMT(DISCIO, "Chunk {} of {} could not be read from the pack", chunk_index, m_path);
+      m_pack.ClearError();
+      return nullptr;
+    }
+
+    auto data = std::make_shared<std::vector<u8>>(data_size);
+    if (entry.flags & ChunkStoreEntry::FLAG_COMPRESSED)
+    {
+      const size_t result = ZSTD_decompress(data->data(), data->size(), m_read_buffer.data(),
+                                            m_read_buffer.size());
+      if (ZSTD_isError(result) || result != data_size)
+      {
+        ERROR_LOG_FMT(DISCIO, "Chunk {} of {} could not be decompressed", chunk_index, m_path);
+        return nullptr;
+      }
+    }
+    else
+    {
+      if (m_read_buffer.size() != data_size)
+      {
+        ERROR_LOG_FMT(DISCIO, "Chunk {} of {} has the wrong size", chunk_index, m_path);
+        return nullptr;
+      }
+      std::ranges::copy(m_read_buffer, data->begin());
+    }
+
+    // The chunk is shared with every other disc image that contains it, so a corrupt chunk must
+    // not make it into the cache
+    if (Common::SHA1::CalculateDigest(*data) != entry.hash)
+    {
+      ERROR_LOG_FMT(DISCIO, "Chunk {} of {} does not match its hash", chunk_index, m_path);
+      return nullptr;
+    }
+
+    chunk = std::move(data);
+    GetSharedChunkCache().Insert(entry.hash, chunk);
+  }
+
+  m_last_chunk_index = chunk_index;
+  m_last_chunk = chunk;
+  return chunk;
+}
+
+namespace
+{
+struct ChunkCompressThreadState
+{
+  ChunkCompressThreadState() = default;
+  ~ChunkCompressThreadState() { ZSTD_freeCCtx(context); }
+
+  ChunkCompressThreadState(const ChunkCompressThreadState&) = delete;
+  ChunkCompressThreadState(ChunkCompressThreadState&&) = delete;
+  ChunkCompressThreadState& operator=(const ChunkCompressThreadState&) = delete;
+  ChunkCompressThreadState& operator=(ChunkCompressThreadState&&) = delete;
+
+  ZSTD_CCtx* context = nullptr;
+};
+
+struct ChunkCompressParameters
+{
+  std::vector<u8> data{};
+  u32 chunk_index = 0;
+  u64 bytes_read = 0;
+};
+
+struct ChunkOutputParameters
+{
+  Common::SHA1::Digest hash{};
+  // Empty if the chunk was already in the store when it was hashed
+  std::vector<u8> data{};
+  bool compressed = false;
+  u32 chunk_index = 0;
+  u64 bytes_read = 0;
+};
+
+// The chunks that the store contains, by hash. Lookups happen on the compression threads, which
+// skip compressing chunks that are already stored, and on the output thread, which adds chunks.
+struct KnownChunks
+{
+  std::optional<ChunkStoreEntry> Find(const Common::SHA1::Digest& hash)
+  {
+    std::lock_guard lk(mutex);
+    const auto it = entries.find(hash);
+    return it != entries.end() ? std::optional(it->second) : std::nullopt;
+  }
+
+  std::mutex mutex;
+  std::map<Common::SHA1::Digest, ChunkStoreEntry> entries;
+};
+
+bool LoadIndex(const std::string& index_path, u64 pack_size, KnownChunks* known_chunks)
+{
+  File::IOFile index(index_path, "rb");
+  if (!index || index.GetSize() == 0)
+    return true;
+
+  ChunkStoreIndexHeader header;
+  if (!index.ReadArray(&header, 1) || header.magic != CHUNK_STORE_INDEX_MAGIC ||
+      header.version != CHUNK_STORE_VERSION)
+  {
+    return false;
+  }
+
+  std::vector<ChunkStoreEntry> entries((index.GetSize() - sizeof(header)) /
+                                       sizeof(ChunkStoreEntry));
+  if (!index.ReadArray(entries.data(), entries.size()))
+    return false;
+
+  // If a conversion was interrupted, the index may refer to data that never made it to the pack.
+  // Such chunks are treated as missing, so that they get stored again.
+  size_t missing_chunks = 0;
+  for (const ChunkStoreEntry& entry : entries)
+  {
+    if (entry.pack_offset > pack_size || entry.stored_size > pack_size - entry.pack_offset)
+      ++missing_chunks;
+    else
+      known_chunks->entries.emplace(entry.hash, entry);
+  }
+
+  if (missing_chunks != 0)
+  {
+    WARN_LOG_FMT(DISCIO, "Ignoring {} chunks in {} which are missing from the pack",
+                 missing_chunks, index_path);
+  }
+  return true;
+}
+}  // namespace
+
+bool ConvertToChunkStore(BlobReader* infile, const std::string& infile_path,
+                         const std::string& outfile_path, int chunk_size, int compression_level,
+                         const CompressCB& callback)
+{
+  ASSERT(infile->GetDataSizeType() == DataSizeType::Accurate);
+  ASSERT(chunk_size > 0);
+
+  const std::string store_folder = GetStoreFolder(outfile_path);
+  const std::string pack_path = store_folder + CHUNK_STORE_PACK_NAME;
+  const std::string index_path = store_folder + CHUNK_STORE_INDEX_NAME;
+
+  u64 pack_offset = File::GetSize(pack_path);
+  KnownChunks known_chunks;
+  if (!LoadIndex(index_path, pack_offset, &known_chunks))
+  {
+    PanicAlertFmtT("The chunk store index \"{0}\" is corrupt.", index_path);
+    return false;
+  }
+
+  const bool new_index = File::GetSize(index_path) == 0;
+  File::IOFile pack(pack_path, "ab");
+  File::IOFile index(index_path, "ab");
+  if (!pack || !index)
+  {
+    PanicAlertFmtT(
+        "Failed to open the output file \"{0}\".\n"
+        "Check that you have permissions to write the target folder and that the media can "
+        "be written.",
+        pack ? index_path : pack_path);
+    return false;
+  }
+
+  if (new_index)
+  {
+    const ChunkStoreIndexHeader index_header{CHUNK_STORE_INDEX_MAGIC, CHUNK_STORE_VERSION};
+    if (!index.WriteArray(&index_header, 1))
+    {
+      PanicAlertFmtT("Failed to write the output file \"{0}\".\n"
+                     "Check that you have enough space available on the target drive.",
+                     index_path);
+      return false;
+    }
+  }
+
+  ChunkStoreHeader header{};
+  header.magic = CHUNK_STORE_MAGIC;
+  header.version = CHUNK_STORE_VERSION;
+  header.data_size = infile->GetDataSize();
+  header.chunk_size = static_cast<u32>(chunk_size);
+  header.num_chunks = static_cast<u32>((header.data_size + chunk_size - 1) / chunk_size);
+
+  std::vector<ChunkStoreEntry> entries(header.num_chunks);
+  u64 new_chunks = 0;
+  const u32 progress_monitor = std::max<u32>(1, header.num_chunks / 1000);
+
+  const auto set_up_compress_thread_state = [](ChunkCompressThreadState* state) {
+    state->context = ZSTD_createCCtx();
+    return state->context ? ConversionResultCode::Success : ConversionResultCode::InternalError;
+  };
+
+  const auto compress = [&](ChunkCompressThreadState* state, ChunkCompressParameters parameters)
+      -> ConversionResult<ChunkOutputParameters> {
+    ChunkOutputParameters output{.hash = Common::SHA1::CalculateDigest(parameters.data),
+                                 .chunk_index = parameters.chunk_index,
+                                 .bytes_read = parameters.bytes_read};
+    if (known_chunks.Find(output.hash))
+      return output;
+
+    std::vector<u8> compressed(ZSTD_compressBound(parameters.data.size()));
+    const size_t result =
+        ZSTD_compressCCtx(state->context, compressed.data(), compressed.size(),
+                          parameters.data.data(), parameters.data.size(), compression_level);
+    if (ZSTD_isError(result))
+      return ConversionResultCode::InternalError;
+
+    // Chunks that don't get smaller are stored as they are
+    if (result < parameters.data.size())
+    {
+      compressed.resize(result);
+      output.data = std::move(compressed);
+      output.compressed = true;
+    }
+    else
+    {
+      output.data = std::move(parameters.data);
+    }
+    return output;
+  };
+
+  const auto output = [&](ChunkOutputParameters parameters) {
+    std::optional<ChunkStoreEntry> entry = known_chunks.Find(parameters.hash);
+    if (!entry)
+    {
+      // An earlier chunk of this disc image may have added the chunk after it was hashed
+      ASSERT(!parameters.data.empty());
+
+      entry = ChunkStoreEntry{};
+      entry->hash = parameters.hash;
+      entry->stored_size = static_cast<u32>(parameters.data.size());
+      entry->pack_offset = pack_offset;
+      entry->flags = parameters.compressed ? ChunkStoreEntry::FLAG_COMPRESSED : 0;
+
+      // The pack is flushed before the index is written, so that an interrupted conversion is
+      // unlikely to leave index entries for missing data. LoadIndex checks for them anyway.
+      if (!pack.WriteBytes(parameters.data.data(), parameters.data.size()) || !pack.Flush() ||
+          !index.WriteArray(&*entry, 1))
+      {
+        return ConversionResultCode::WriteFailed;
+      }
+      pack_offset += parameters.data.size();
+      ++new_chunks;
+
+      std::lock_guard lk(known_chunks.mutex);
+      known_chunks.entries.emplace(entry->hash, *entry);
+    }
+
+    entries[parameters.chunk_index] = *entry;
+
+    if (parameters.chunk_index % progress_monitor == 0)
+    {
+      const std::string text =
+          Common::FmtFormatT("{0} of {1} chunks. {2} chunks were not in the store yet.",
+                             parameters.chunk_index, header.num_chunks, new_chunks);
+      const float completion = static_cast<float>(parameters.chunk_index) / header.num_chunks;
+      if (!callback(text, completion))
+        return ConversionResultCode::Canceled;
+    }
+
+    return ConversionResultCode::Success;
+  };
+
+  MultithreadedCompressor<ChunkCompressThreadState, ChunkCompressParameters, ChunkOutputParameters>
+      compressor(set_up_compress_thread_state, compress, output);
+
+  u64 inpos = 0;
+  for (u32 i = 0; i < header.num_chunks; i++)
+  {
+    if (compressor.GetStatus() != ConversionResultCode::Success)
+      break;
+
+    const u64 bytes_to_read = GetChunkDataSize(header, i);
+    std::vector<u8> buffer(bytes_to_read);
+    if (!infile->Read(inpos, bytes_to_read, buffer.data()))
+    {
+      compressor.SetError(ConversionResultCode::ReadFailed);
+      break;
+    }
+    inpos += bytes_to_read;
+
+    compressor.CompressAndWrite(ChunkCompressParameters{std::move(buffer), i, inpos});
+  }
+
+  compressor.Shutdown();
+
+  ConversionResultCode result = compressor.GetStatus();
+
+  // The disc image file is written last, so that it only ever refers to chunks that are stored
+  if (result == ConversionResultCode::Success && (!pack.Close() || !index.Close()))
+    result = ConversionResultCode::WriteFailed;
+
+  if (result == ConversionResultCode::Success)
+  {
+    File::IOFile outfile(outfile_path, "wb");
+    if (!outfile || !outfile.WriteArray(&header, 1) ||
+        !outfile.WriteArray(entries.data(), entries.size()) || !outfile.Close())
+    {
+      result = ConversionResultCode::WriteFailed;
+      File::Delete(outfile_path);
+    }
+  }
+
+  if (result == ConversionResultCode::Success)
+  {
+    INFO_LOG_FMT(DISCIO, "Stored {} in {}: {} of {} chunks were new", infile_path, store_folder,
+                 new_chunks, header.num_chunks);
+    callback(Common::GetStringT("Done compressing disc image."), 1.0f);
+  }
+
+  if (result == ConversionResultCode::ReadFailed)
+    PanicAlertFmtT("Failed to read from the input file \"{0}\".", infile_path);
+
+  if (result == ConversionResultCode::WriteFailed)
+  {
+    PanicAlertFmtT("Failed to write the output file \"{0}\".\n"
+                   "Check that you have enough space available on the target drive.",
+                   outfile_path);
+  }
+
+  return result == ConversionResultCode::Success;
+}
+
+}  // namespace DiscIO
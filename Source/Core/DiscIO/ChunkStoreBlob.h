@@ -0,0 +1,108 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
+#include "Common/IOFile.h"
+#include "DiscIO/Blob.h"
+
+// WARNING Code not big-endian safe.
+
+// A chunk store keeps the data of several disc images in one folder, so that data which is
+// identical between them (for instance between revisions or regional versions of a game) is only
+// stored once. The folder contains:
+// * chunks.pack: Zstandard compressed chunks of disc data, appended one after another.
+// * chunks.index: A ChunkStoreIndexHeader followed by one ChunkStoreEntry for each chunk in the
+//   pack, which lets conversions find chunks that are already stored by their hash.
+// * One file per disc image: A ChunkStoreHeader followed by one ChunkStoreEntry for each chunk of
+//   the disc. This is the file that gets opened as a BlobReader.
+
+namespace DiscIO
+{
+static constexpr u32 CHUNK_STORE_MAGIC = 0x01534344;        // "DCS\x1"
+static constexpr u32 CHUNK_STORE_INDEX_MAGIC = 0x01494344;  // "DCI\x1"
+static constexpr u32 CHUNK_STORE_VERSION = 1;
+
+static constexpr char CHUNK_STORE_PACK_NAME[] = "chunks.pack";
+static constexpr char CHUNK_STORE_INDEX_NAME[] = "chunks.index";
+
+struct ChunkStoreHeader
+{
+  u32 magic;
+  u32 version;
+  u64 data_size;
+  u32 chunk_size;
+  u32 num_chunks;
+};
+static_assert(sizeof(ChunkStoreHeader) == 0x18);
+
+struct ChunkStoreIndexHeader
+{
+  u32 magic;
+  u32 version;
+};
+static_assert(sizeof(ChunkStoreIndexHeader) == 0x8);
+
+struct ChunkStoreEntry
+{
+  static constexpr u32 FLAG_COMPRESSED = 1;
+
+  // Hash of the uncompressed data of the chunk
+  Common::SHA1::Digest hash;
+  u32 stored_size;
+  u64 pack_offset;
+  u32 flags;
+  u32 padding;
+};
+static_assert(sizeof(ChunkStoreEntry) == 0x28);
+
+class ChunkStoreFileReader final : public BlobReader
+{
+public:
+  static std::unique_ptr<ChunkStoreFileReader> Create(File::IOFile file, const std::string& path);
+
+  BlobType GetBlobType() const override { return BlobType::CHUNK_STORE; }
+  std::unique_ptr<BlobReader> CopyReader() const override;
+
+  // Counts chunks that are shared with other disc images as if they weren't shared
+  u64 GetRawSize() const override { return m_raw_size; }
+  u64 GetDataSize() const override { return m_header.data_size; }
+  DataSizeType GetDataSizeType() const override { return DataSizeType::Accurate; }
+
+  u64 GetBlockSize() const override { return m_header.chunk_size; }
+  bool HasFastRandomAccessInBlock() const override { return false; }
+  std::string GetCompressionMethod() const override { return "Zstandard"; }
+  std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
+  std::optional<BlobCacheStatistics> GetCacheStatistics() const override;
+
+  bool Read(u64 offset, u64 size, u8* out_ptr) override;
+
+private:
+  ChunkStoreFileReader(ChunkStoreHeader header, std::vector<ChunkStoreEntry> entries,
+                       File::IOFile pack, std::string path, u64 raw_size);
+
+  std::shared_ptr<const std::vector<u8>> GetChunk(u64 chunk_index);
+
+  ChunkStoreHeader m_header;
+  std::vector<ChunkStoreEntry> m_entries;
+  File::IOFile m_pack;
+  std::string m_path;
+  u64 m_raw_size;
+
+  std::vector<u8> m_read_buffer;
+  u64 m_last_chunk_index = 0;
+  std::shared_ptr<const std::vector<u8>> m_last_chunk;
+
+  std::atomic<u64> m_hits = 0;
+  std::atomic<u64> m_misses = 0;
+};
+
+}  // namespace DiscIO
@@ -32,6 +32,8 @@
 
 namespace DiscIO
 {
+static constexpr u64 UNCOMPRESSED_FLAG = 1ULL << 63;
+
 bool IsGCZBlob(File::IOFile& file);
 
 CompressedBlobReader::CompressedBlobReader(File::IOFile file, const std::string& filename)
@@ -58,6 +60,13 @@ CompressedBlobReader::CompressedBlobReader(File::IOFile file, const std::string&
   // I still add some safety margin.
   const u32 zlib_buffer_size = m_header.block_size + 64;
   m_zlib_buffer.resize(zlib_buffer_size);
+
+  inflateInit(&m_inflate_stream);
+
+  // Let each cache line hold several blocks when the blocks are small. Misses then fetch one
+  // contiguous range of the file.
+  if (m_header.block_size != 0)
+    SetChunkSize(std::max<int>(1, CACHE_LINE_SIZE / m_header.block_size));
 }
 
 std::unique_ptr<CompressedBlobReader> CompressedBlobReader::Create(File::IOFile file,
@@ -70,7 +79,10 @@ std::unique_ptr<CompressedBlobReader> CompressedBlobReader::Create(File::IOFile
   return nullptr;
 }
 
-CompressedBlobReader::~CompressedBlobReader() = default;
+CompressedBlobReader::~CompressedBlobReader()
+{
+  inflateEnd(&m_inflate_stream);
+}
 
 std::unique_ptr<BlobReader> CompressedBlobReader::CopyReader() const
 {
@@ -92,23 +104,23 @@ u64 CompressedBlobReader::GetBlockCompressedSize(u64 block_num) const
 
 bool CompressedBlobReader::GetBlock(u64 block_num, u8* out_ptr)
 {
-  bool uncompressed = false;
-  u32 comp_block_size = (u32)GetBlockCompressedSize(block_num);
-  u64 offset = m_block_pointers[block_num] + m_data_offset;
-
-  if (offset & (1ULL << 63))
-  {
-    if (comp_block_size != m_header.block_size)
-      ERROR_LOG_FMT(DISCIO, "Uncompressed block with wrong size");
-    uncompressed = true;
-    offset &= ~(1ULL << 63);
-  }
-
-  // clear unused part of zlib buffer. maybe this can be deleted when it works fully.
-  memset(&m_zlib_buffer[comp_block_size], 0, m_zlib_buffer.size() - comp_block_size);
+  return ReadMultipleAlignedBlocks(block_num, 1, out_ptr);
+}
 
-  m_file.Seek(offset, File::SeekOrigin::Begin);
-  if (!m_file.ReadBytes(m_zlib_buffer.data(), comp_block_size))
+bool CompressedBlobReader::ReadMultipleAlignedBlocks(u64 block_num, u64 num_blocks, u8* out_ptr)
+{
+  // The blocks are stored back to back, so all of them can be fetched with a single read
+  const u64 first_offset = m_block_pointers[block_num] & ~UNCOMPRESSED_FLAG;
+  const u64 last_block = block_num + num_blocks - 1;
+  const u64 end_offset = (m_block_pointers[last_block] & ~UNCOMPRESSED_FLAG) +
+                         static_cast<u32>(GetBlockCompressedSize(last_block));
+  const u64 read_size = end_offset - first_offset;
+
+  if (m_zlib_buffer.size() < read_size)
+    m_zlib_buffer.resize(read_size);
+
+  m_file.Seek(first_offset + m_data_offset, File::SeekOrigin::Begin);
+  if (!m_file.ReadBytes(m_zlib_buffer.data(), read_size))
   {
     ERROR_LOG_FMT(DISCIO, "The disc image \"{}\" is truncated, some of the data is missing.",
                   m_file_name);
@@ -116,8 +128,26 @@ bool CompressedBlobReader::GetBlock(u64 block_num, u8* out_ptr)
     return false;
   }
 
+  bool success = true;
+  for (u64 i = block_num; i < block_num + num_blocks; ++i)
+  {
+    const u64 offset = (m_block_pointers[i] & ~UNCOMPRESSED_FLAG) - first_offset;
+    success &= DecompressBlock(i, m_zlib_buffer.data() + offset,
+                               static_cast<u32>(GetBlockCompressedSize(i)),
+                               out_ptr + (i - block_num) * m_header.block_size);
+  }
+  return success;
+}
+
+bool CompressedBlobReader::DecompressBlock(u64 block_num, const u8* in_ptr, u32 comp_block_size,
+                                           u8* out_ptr)
+{
+  const bool uncompressed = (m_block_pointers[block_num] & UNCOMPRESSED_FLAG) != 0;
+  if (uncompressed && comp_block_size != m_header.block_size)
+    ERROR_LOG_FMT(DISCIO, "Uncompressed block with wrong size");
+
   // First, check hash.
-  const u32 block_hash = Common::HashAdler32(m_zlib_buffer.data(), comp_block_size);
+  const u32 block_hash = Common::HashAdler32(in_ptr, comp_block_size);
   if (block_hash != m_hashes[block_num])
   {
     ERROR_LOG_FMT(DISCIO,
@@ -128,34 +158,34 @@ bool CompressedBlobReader::GetBlock(u64 block_num, u8* out_ptr)
 
   if (uncompressed)
   {
-    std::copy_n(m_zlib_buffer.begin(), comp_block_size, out_ptr);
+    std::copy_n(in_ptr, std::min(comp_block_size, m_header.block_size), out_ptr);
+    return true;
   }
-  else
+
+  if (comp_block_size > m_header.block_size)
   {
-    z_stream z = {};
-    z.next_in = m_zlib_buffer.data();
-    z.avail_in = comp_block_size;
-    if (z.avail_in > m_header.block_size)
-    {
-      ERROR_LOG_FMT(DISCIO, "Compressed block size is larger than uncompressed block size");
-    }
-    z.next_out = out_ptr;
-    z.avail_out = m_header.block_size;
-    inflateInit(&z);
-    int status = inflate(&z, Z_FULL_FLUSH);
-    u32 uncomp_size = m_header.block_size - z.avail_out;
-    if (status != Z_STREAM_END)
-    {
-      // this seem to fire wrongly from time to time
-      // to be sure, don't use compressed isos :P
-      ERROR_LOG_FMT(DISCIO, "Failure reading block {} - out of data and not at end.", block_num);
-    }
-    inflateEnd(&z);
-    if (uncomp_size != m_header.block_size)
-    {
-      ERROR_LOG_FMT(DISCIO, "Wrong block size");
-      return false;
-    }
+    ERROR_LOG_FMT(DISCIO, "Compressed block size is larger than uncompressed block size");
+  }
+
+  // Resetting the stream is much cheaper than setting up a new one for every block
+  z_stream& z = m_inflate_stream;
+  inflateReset(&z);
+  z.next_in = const_cast<u8*>(in_ptr);
+  z.avail_in = comp_block_size;
+  z.next_out = out_ptr;
+  z.avail_out = m_header.block_size;
+  const int status = inflate(&z, Z_FULL_FLUSH);
+  const u32 uncomp_size = m_header.block_size - z.avail_out;
+  if (status != Z_STREAM_END)
+  {
+    // this seem to fire wrongly from time to time
+    // to be sure, don't use compressed isos :P
+    ERROR_LOG_FMT(DISCIO, "Failure reading block {} - out of data and not at end.", block_num);
+  }
+  if (uncomp_size != m_header.block_size)
+  {
+    ERROR_LOG_FMT(DISCIO, "Wrong block size");
+    return false;
   }
   return true;
 }
@@ -274,7 +304,7 @@ static ConversionResultCode Output(OutputParameters parameters, File::IOFile* ou
 
 bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
                   const std::string& outfile_path, u32 sub_type, int block_size,
-                  const CompressCB& callback)
+                  const CompressCB& callback, const ConversionLimits& limits)
 {
   ASSERT(infile->GetDataSizeType() == DataSizeType::Accurate);
 
@@ -325,8 +355,20 @@ bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
                   header.num_blocks, callback);
   };
 
+  // Each compression thread can hold one input buffer and one output buffer of a block each.
+  // One more input buffer is used for reading.
+  size_t threads = limits.threads != 0 ?
+                       limits.threads :
+                       MultithreadedCompressor<CompressThreadState, CompressParameters,
+                                               OutputParameters>::GetDefaultThreadCount();
+  if (limits.memory != 0)
+  {
+    const u64 buffers = limits.memory / block_size;
+    threads = std::clamp<u64>(buffers > 1 ? (buffers - 1) / 2 : 0, 1, threads);
+  }
+
   MultithreadedCompressor<CompressThreadState, CompressParameters, OutputParameters> compressor(
-      SetUpCompressThreadState, compress, output);
+      SetUpCompressThreadState, compress, output, threads);
 
   std::vector<u8> in_buf(block_size);
   for (u32 i = 0; i < header.num_blocks; i++)
@@ -16,6 +16,8 @@
 #include <string>
 #include <vector>
 
+#include <zlib.h>
+
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
 #include "DiscIO/Blob.h"
@@ -63,10 +65,16 @@ public:
 
   u64 GetBlockCompressedSize(u64 block_num) const;
   bool GetBlock(u64 block_num, u8* out_ptr) override;
+  bool ReadMultipleAlignedBlocks(u64 block_num, u64 num_blocks, u8* out_ptr) override;
 
 private:
+  // Amount of data that each cache line of the SectorReader holds when blocks are small.
+  static constexpr u32 CACHE_LINE_SIZE = 0x20000;
+
   CompressedBlobReader(File::IOFile file, const std::string& filename);
 
+  bool DecompressBlock(u64 block_num, const u8* in_ptr, u32 comp_block_size, u8* out_ptr);
+
   CompressedBlobHeader m_header;
   std::vector<u64> m_block_pointers;
   std::vector<u32> m_hashes;
@@ -74,6 +82,8 @@ private:
   File::IOFile m_file;
   u64 m_file_size;
   std::vector<u8> m_zlib_buffer;
+  // z_stream will stop working if it changes address, so this object must not be moved
+  z_stream m_inflate_stream{};
   std::string m_file_name;
 };
 
@@ -28,6 +28,7 @@
 #include "Core/IOS/ES/Formats.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscUtils.h"
+#include "DiscIO/FileBlob.h"
 #include "DiscIO/VolumeDisc.h"
 #include "DiscIO/VolumeWii.h"
 #include "DiscIO/WiiEncryptionCache.h"
@@ -97,9 +98,8 @@ bool DiscContent::Read(u64* offset, u64* length, u8** buffer, DirectoryBlobReade
     if (std::holds_alternative<ContentFile>(m_content_source))
     {
       const auto& content = std::get<ContentFile>(m_content_source);
-      File::IOFile file(content.m_filename, "rb");
-      if (!file.Seek(content.m_offset + offset_in_content, File::SeekOrigin::Begin) ||
-          !file.ReadBytes(*buffer, bytes_to_read))
+      if (!blob->ReadFromHostFile(content.m_filename, content.m_offset + offset_in_content,
+                                  bytes_to_read, *buffer))
       {
         return false;
       }
@@ -515,6 +515,66 @@ bool DirectoryBlobReader::Read(u64 offset, u64 length, u8* buffer)
       .Read(offset, length, buffer, this);
 }
 
+bool DirectoryBlobReader::ReadFromHostFile(const std::string& path, u64 offset, u64 size,
+                                           u8* buffer)
+{
+  if constexpr (MAX_OPEN_HOST_FILES == 0)
+  {
+    OpenHostFile file;
+    return file.Open(path) && file.Read(offset, size, buffer);
+  }
+  else
+  {
+    const u64 now = ++m_open_host_file_counter;
+
+    auto it = std::ranges::find(m_open_host_files, path, &OpenHostFile::path);
+    if (it == m_open_host_files.end())
+    {
+      OpenHostFile file;
+      if (!file.Open(path))
+        return false;
+
+      if (m_open_host_files.size() < MAX_OPEN_HOST_FILES)
+        it = m_open_host_files.emplace(m_open_host_files.end());
+      else
+        it = std::ranges::min_element(m_open_host_files, {}, &OpenHostFile::last_used);
+
+      *it = std::move(file);
+    }
+
+    it->last_used = now;
+    return it->Read(offset, size, buffer);
+  }
+}
+
+bool DirectoryBlobReader::OpenHostFile::Open(const std::string& path_)
+{
+  path = path_;
+  file = File::IOFile(path, "rb");
+  if (!file)
+    return false;
+
+  // PlainFileReader checks the size of the file before every read from the mapping, so a mapped
+  // file that gets truncated makes reads fail instead of crashing
+  if (file.GetSize() >= MIN_MAPPED_HOST_FILE_SIZE)
+    mapped_reader = PlainFileReader::Create(std::move(file));
+
+  return true;
+}
+
+bool DirectoryBlobReader::OpenHostFile::Read(u64 offset, u64 size, u8* buffer)
+{
+  if (mapped_reader)
+    return mapped_reader->Read(offset, size, buffer);
+
+  if (!file.Seek(offset, File::SeekOrigin::Begin) || !file.ReadBytes(buffer, size))
+  {
+    file.ClearError();
+    return false;
+  }
+  return true;
+}
+
 const DirectoryBlobPartition* DirectoryBlobReader::GetPartition(u64 offset, u64 size,
                                                                 u64 partition_data_offset) const
 {
@@ -580,6 +640,17 @@ u64 DirectoryBlobReader::GetDataSize() const
   return m_data_size;
 }
 
+std::optional<BlobCacheStatistics> DirectoryBlobReader::GetCacheStatistics() const
+{
+  if (!m_is_wii || !m_encrypted)
+    return std::nullopt;
+
+  const WiiEncryptionCache::Statistics encryption = m_encryption_cache.GetStatistics();
+  return BlobCacheStatistics{.encrypted_group_hits = encryption.hits,
+                             .encrypted_group_misses = encryption.misses,
+                             .encrypted_group_thrashes = encryption.thrashes};
+}
+
 void DirectoryBlobReader::SetNonpartitionDiscHeaderFromFile(const std::vector<u8>& partition_header,
                                                             const std::string& game_partition_root)
 {
@@ -16,7 +16,9 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
+#include "Common/IOFile.h"
 #include "DiscIO/Blob.h"
+#include "DiscIO/FileBlob.h"
 #include "DiscIO/Volume.h"
 #include "DiscIO/WiiEncryptionCache.h"
 
@@ -253,8 +255,8 @@ public:
       const std::function<void(std::vector<FSTBuilderNode>* fst_nodes, FSTBuilderNode* dol_node)>&
           fst_callback);
 
-  DirectoryBlobReader(DirectoryBlobReader&&) = default;
-  DirectoryBlobReader& operator=(DirectoryBlobReader&&) = default;
+  DirectoryBlobReader(DirectoryBlobReader&&) = delete;
+  DirectoryBlobReader& operator=(DirectoryBlobReader&&) = delete;
 
   bool Read(u64 offset, u64 length, u8* buffer) override;
   bool SupportsReadWiiDecrypted(u64 offset, u64 size, u64 partition_data_offset) const override;
@@ -271,6 +273,7 @@ public:
   bool HasFastRandomAccessInBlock() const override { return true; }
   std::string GetCompressionMethod() const override { return {}; }
   std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
+  std::optional<BlobCacheStatistics> GetCacheStatistics() const override;
 
 private:
   struct PartitionWithType
@@ -309,6 +312,34 @@ private:
 
   const VolumeDisc* GetWrappedVolume() const { return m_wrapped_volume.get(); }
 
+  // Reads from a host file through the cache of open files.
+  bool ReadFromHostFile(const std::string& path, u64 offset, u64 size, u8* buffer);
+
+  // Host files that content was recently read from. Keeping them open means that reads which
+  // cross many small files don't have to open every one of them again. Large files are read
+  // through a PlainFileReader, which memory maps them so that reads are served with memcpy.
+  // Copies of the reader start out empty.
+  struct OpenHostFile
+  {
+    bool Open(const std::string& path_);
+    bool Read(u64 offset, u64 size, u8* buffer);
+
+    std::string path;
+    File::IOFile file;
+    std::unique_ptr<PlainFileReader> mapped_reader;
+    u64 last_used = 0;
+  };
+
+#ifdef _WIN32
+  // Files that are open on Windows can't be replaced, which is how mods are usually edited while
+  // the game is running, so they are opened for every read instead.
+  static constexpr size_t MAX_OPEN_HOST_FILES = 0;
+#else
+  static constexpr size_t MAX_OPEN_HOST_FILES = 16;
+#endif
+  // Mapping a file costs more than it saves for smaller files.
+  static constexpr u64 MIN_MAPPED_HOST_FILE_SIZE = 0x800000;
+
   // For GameCube:
   DirectoryBlobPartition m_gamecube_pseudopartition;
 
@@ -323,6 +354,9 @@ private:
   u64 m_data_size;
 
   std::unique_ptr<VolumeDisc> m_wrapped_volume;
+
+  std::vector<OpenHostFile> m_open_host_files;
+  u64 m_open_host_file_counter = 0;
 };
 
 }  // namespace DiscIO
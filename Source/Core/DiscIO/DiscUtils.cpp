@@ -234,6 +234,15 @@ bool IsDiscImageBlockSizeValid(int block_size, BlobType format)
       return false;
     }
 
+    break;
+  case BlobType::CHUNK_STORE:
+    // Block size must be a power of 2 between the minimum and the maximum
+    if (block_size < CHUNK_STORE_MIN_BLOCK_SIZE || block_size > CHUNK_STORE_MAX_BLOCK_SIZE ||
+        !MathUtil::IsPow2(block_size))
+    {
+      return false;
+    }
+
     break;
   default:
     ASSERT(false);
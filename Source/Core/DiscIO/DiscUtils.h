@@ -75,6 +75,12 @@ constexpr int RVZ_MIN_BLOCK_SIZE = 0x8000;
 // 2 MiB (0x200000): for RVZ, block sizes larger than 2 MiB must be an integer multiple of 2 MiB.
 constexpr int RVZ_BIG_BLOCK_SIZE_LCM = 0x200000;
 
+// 32 KiB (0x8000) is the smallest chunk size supported by chunk stores.
+constexpr int CHUNK_STORE_MIN_BLOCK_SIZE = 0x8000;
+
+// 16 MiB (0x1000000) is the largest chunk size supported by chunk stores.
+constexpr int CHUNK_STORE_MAX_BLOCK_SIZE = 0x1000000;
+
 std::string NameForPartitionType(u32 partition_type, bool include_prefix);
 
 std::optional<u64> GetApploaderSize(const Volume& volume, const Partition& partition);
@@ -4,20 +4,53 @@
 #include "DiscIO/FileBlob.h"
 
 #include <algorithm>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
 
 namespace DiscIO
 {
+// How far ahead of sequential reads the OS is asked to page in the file
+constexpr u64 READ_AHEAD_SIZE = 0x200000;
+
 PlainFileReader::PlainFileReader(File::IOFile file) : m_file(std::move(file))
 {
   m_size = m_file.GetSize();
+
+#ifndef _WIN32
+  if (m_size != 0 && m_size <= std::numeric_limits<size_t>::max())
+  {
+    const int fd = fileno(m_file.GetHandle());
+    void* data = mmap(nullptr, static_cast<size_t>(m_size), PROT_READ, MAP_SHARED, fd, 0);
+    if (data != MAP_FAILED)
+    {
+      m_mapped_data = static_cast<const u8*>(data);
+      m_mapped_fd = fd;
+    }
+  }
+#endif
+}
+
+PlainFileReader::~PlainFileReader()
+{
+#ifndef _WIN32
+  if (m_mapped_data)
+    munmap(const_cast<u8*>(m_mapped_data), static_cast<size_t>(m_size));
+#endif
 }
 
 std::unique_ptr<PlainFileReader> PlainFileReader::Create(File::IOFile file)
@@ -35,6 +68,21 @@ std::unique_ptr<BlobReader> PlainFileReader::CopyReader() const
 
 bool PlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 {
+  if (IsMappedRangeValid(offset, nbytes))
+  {
+    std::memcpy(out_ptr, m_mapped_data + offset, nbytes);
+
+    const u64 end = offset + nbytes;
+    if (offset == m_last_read_end && end + READ_AHEAD_SIZE / 2 > m_advised_end)
+    {
+      AdviseWillNeed(end, READ_AHEAD_SIZE);
+      m_advised_end = end + READ_AHEAD_SIZE;
+    }
+    m_last_read_end = end;
+
+    return true;
+  }
+
   if (m_file.Seek(offset, File::SeekOrigin::Begin) && m_file.ReadBytes(out_ptr, nbytes))
   {
     return true;
@@ -46,6 +94,48 @@ bool PlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
   }
 }
 
+const u8* PlainFileReader::GetMappedData(u64 offset, u64 size) const
+{
+  if (!IsMappedRangeValid(offset, size))
+    return nullptr;
+
+  // The caller is going to access the data soon, so start paging it in now
+  AdviseWillNeed(offset, size);
+  return m_mapped_data + offset;
+}
+
+bool PlainFileReader::IsMappedRangeValid(u64 offset, u64 size) const
+{
+  // If the file gets truncated while it's mapped (for instance because it was edited or because
+  // the drive it's on was unplugged), accessing the missing pages raises SIGBUS instead of making
+  // the read fail. Such ranges are read with regular file I/O instead, which fails cleanly.
+  // fstat doesn't touch the position of the stream, which the fallback reads rely on.
+#ifdef _WIN32
+  return false;
+#else
+  if (!m_mapped_data || offset > m_size || size > m_size - offset)
+    return false;
+
+  struct stat file_info;
+  return fstat(m_mapped_fd, &file_info) == 0 &&
+         offset + size <= static_cast<u64>(file_info.st_size);
+#endif
+}
+
+void PlainFileReader::AdviseWillNeed(u64 offset, u64 size) const
+{
+#ifndef _WIN32
+  const u64 page_size = static_cast<u64>(sysconf(_SC_PAGESIZE));
+  const u64 start = Common::AlignDown(offset, page_size);
+  const u64 end = std::min(offset + size, m_size);
+  if (start < end)
+  {
+    madvise(const_cast<u8*>(m_mapped_data) + start, static_cast<size_t>(end - start),
+            MADV_WILLNEED);
+  }
+#endif
+}
+
 bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
                     const std::string& outfile_path, const CompressCB& callback)
 {
@@ -17,6 +17,7 @@ class PlainFileReader final : public BlobReader
 {
 public:
   static std::unique_ptr<PlainFileReader> Create(File::IOFile file);
+  ~PlainFileReader();
 
   BlobType GetBlobType() const override { return BlobType::PLAIN; }
   std::unique_ptr<BlobReader> CopyReader() const override;
@@ -31,12 +32,22 @@ public:
   std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
 
   bool Read(u64 offset, u64 nbytes, u8* out_ptr) override;
+  const u8* GetMappedData(u64 offset, u64 size) const override;
 
 private:
   PlainFileReader(File::IOFile file);
 
+  bool IsMappedRangeValid(u64 offset, u64 size) const;
+  void AdviseWillNeed(u64 offset, u64 size) const;
+
   File::IOFile m_file;
   u64 m_size;
+
+  // The whole file, if it could be memory mapped. Reads are then served with memcpy.
+  const u8* m_mapped_data = nullptr;
+  int m_mapped_fd = -1;
+  u64 m_last_read_end = 0;
+  u64 m_advised_end = 0;
 };
 
 }  // namespace DiscIO
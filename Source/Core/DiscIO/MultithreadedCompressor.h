@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <thread>
@@ -37,6 +39,8 @@ using ConversionResult = Common::Result<ConversionResultCode, T>;
 // but the compression threads are not guaranteed to handle data in a predictable order.
 // Remember to check GetStatus regularly and cancel if it doesn't return Success,
 // and call Shutdown when you want to ensure that everything finishes.
+// Each compression thread holds at most one set of parameters waiting to be compressed and one set
+// waiting to be output, so the number of threads also bounds the memory used for buffering.
 template <typename CompressThreadState, typename CompressParameters, typename OutputParameters>
 class MultithreadedCompressor
 {
@@ -45,10 +49,10 @@ public:
       std::function<ConversionResultCode(CompressThreadState*)> set_up_compress_thread_state,
       std::function<ConversionResult<OutputParameters>(CompressThreadState*, CompressParameters)>
           compress,
-      std::function<ConversionResultCode(OutputParameters)> output)
+      std::function<ConversionResultCode(OutputParameters)> output, size_t threads = 0)
       : m_set_up_compress_thread_state(std::move(set_up_compress_thread_state)),
         m_compress(std::move(compress)), m_output(std::move(output)),
-        m_threads(std::max<unsigned int>(1, std::thread::hardware_concurrency()))
+        m_threads(threads != 0 ? threads : GetDefaultThreadCount())
   {
     m_compress_threads = std::make_unique<CompressThread[]>(m_threads);
 
@@ -96,6 +100,13 @@ public:
 
   ConversionResultCode GetStatus() const { return m_result.load(); }
 
+  size_t GetThreadCount() const { return m_threads; }
+
+  static size_t GetDefaultThreadCount()
+  {
+    return std::max<unsigned int>(1, std::thread::hardware_concurrency());
+  }
+
   void Shutdown()
   {
     for (size_t i = 0; i < m_threads; ++i)
@@ -59,6 +59,11 @@ public:
       return std::nullopt;
     return static_cast<u64>(*temp) << GetOffsetShift();
   }
+  // See BlobReader::GetMappedData
+  virtual const u8* GetMappedData(u64 offset, u64 length, const Partition& partition) const
+  {
+    return nullptr;
+  }
 
   virtual bool HasWiiHashes() const { return false; }
   virtual bool HasWiiEncryption() const { return false; }
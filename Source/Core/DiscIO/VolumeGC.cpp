@@ -69,6 +69,14 @@ bool VolumeGC::Read(u64 offset, u64 length, u8* buffer, const Partition& partiti
   return m_reader->Read(offset, length, buffer);
 }
 
+const u8* VolumeGC::GetMappedData(u64 offset, u64 length, const Partition& partition) const
+{
+  if (partition != PARTITION_NONE)
+    return nullptr;
+
+  return m_reader->GetMappedData(offset, length);
+}
+
 const FileSystem* VolumeGC::GetFileSystem(const Partition& partition) const
 {
   return m_file_system->get();
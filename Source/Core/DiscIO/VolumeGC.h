@@ -32,6 +32,7 @@ public:
   ~VolumeGC();
   bool Read(u64 offset, u64 length, u8* buffer,
             const Partition& partition = PARTITION_NONE) const override;
+  const u8* GetMappedData(u64 offset, u64 length, const Partition& partition) const override;
   const FileSystem* GetFileSystem(const Partition& partition = PARTITION_NONE) const override;
   std::string GetGameTDBID(const Partition& partition = PARTITION_NONE) const override;
   std::string GetTriforceID() const override;
@@ -10,7 +10,9 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_set>
+#include <utility>
 
 #include <mbedtls/md5.h>
 #include <mz.h>
@@ -36,6 +38,7 @@
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
+#include "Common/Timer.h"
 #include "Common/Version.h"
 #include "Core/IOS/Device.h"
 #include "Core/IOS/ES/ES.h"
@@ -361,7 +364,11 @@ RedumpVerifier::Result RedumpVerifier::Finish(const Hashes<std::vector<u8>>& has
   return {Status::Unknown, Common::GetStringT("Unknown disc")};
 }
 
-constexpr u64 DEFAULT_READ_SIZE = 0x20000;  // Arbitrary value
+// Large enough that starting the async operations for each chunk is cheap in comparison
+constexpr u64 DEFAULT_READ_SIZE = 0x200000;
+
+// The blocks of a Wii group are decrypted and hashed on up to this many threads
+constexpr size_t MAX_BLOCK_CHECK_THREADS = 8;
 
 VolumeVerifier::VolumeVerifier(const Volume& volume, bool redump_verification,
                                Hashes<bool> hashes_to_calculate)
@@ -1093,7 +1100,8 @@ void VolumeVerifier::WaitForAsyncOperations() const
 
 bool VolumeVerifier::ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read)
 {
-  std::vector<u8> data(bytes_to_read);
+  std::vector<u8>& data = m_next_data;
+  data.resize(bytes_to_read);
 
   const u64 bytes_to_copy = std::min(m_excess_bytes, bytes_to_read);
   if (bytes_to_copy > 0)
@@ -1102,18 +1110,82 @@ bool VolumeVerifier::ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read)
 
   if (bytes_to_read > 0)
   {
-    if (!m_volume.Read(m_progress + bytes_to_copy, bytes_to_read, data.data() + bytes_to_copy,
-                       PARTITION_NONE))
-    {
+    const u64 read_start_us = Common::Timer::NowUs();
+    const bool success = m_volume.Read(m_progress + bytes_to_copy, bytes_to_read,
+                                       data.data() + bytes_to_copy, PARTITION_NONE);
+    m_timings.read_us += Common::Timer::NowUs() - read_start_us;
+    if (!success)
       return false;
-    }
   }
 
+  const u64 wait_start_us = Common::Timer::NowUs();
   WaitForAsyncOperations();
-  m_data = std::move(data);
+  m_timings.wait_us += Common::Timer::NowUs() - wait_start_us;
+
+  std::swap(m_data, m_next_data);
   return true;
 }
 
+void VolumeVerifier::CheckGroup(const GroupToVerify& group, bool read_failed)
+{
+  const size_t num_blocks = group.block_index_end - group.block_index_start;
+  std::vector<u8> block_ok(num_blocks);
+  const auto check_blocks = [&](size_t start, size_t end) {
+    for (size_t i = start; i < end; ++i)
+    {
+      block_ok[i] = !read_failed && m_volume.CheckBlockIntegrity(
+                                        group.block_index_start + i,
+                                        m_data.data() + i * VolumeWii::BLOCK_TOTAL_SIZE,
+                                        group.partition);
+    }
+  };
+
+  // The first block is checked on its own so that the partition's lazily initialized key and H3
+  // table are ready before several threads start using them
+  if (num_blocks > 0)
+    check_blocks(0, 1);
+
+  const size_t remaining_blocks = num_blocks > 0 ? num_blocks - 1 : 0;
+  const size_t threads = std::min<size_t>(
+      {MAX_BLOCK_CHECK_THREADS, std::max(std::thread::hardware_concurrency(), 1u),
+       remaining_blocks});
+  std::vector<std::future<void>> futures;
+  for (size_t i = 1; i < threads; ++i)
+  {
+    futures.push_back(std::async(std::launch::async, check_blocks,
+                                 1 + i * remaining_blocks / threads,
+                                 1 + (i + 1) * remaining_blocks / threads));
+  }
+  if (threads > 0)
+    check_blocks(1, 1 + remaining_blocks / threads);
+  for (std::future<void>& future : futures)
+    future.get();
+
+  for (size_t i = 0; i < num_blocks; ++i)
+  {
+    const u64 block_offset = group.offset + i * VolumeWii::BLOCK_TOTAL_SIZE;
+
+    if (block_ok[i])
+    {
+      m_biggest_verified_offset =
+          std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
+    }
+    else
+    {
+      if (m_scrubber.CanBlockBeScrubbed(block_offset))
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block_offset);
+        m_unused_block_errors[group.partition]++;
+      }
+      else
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block_offset);
+        m_block_errors[group.partition]++;
+      }
+    }
+  }
+}
+
 void VolumeVerifier::Process()
 {
   ASSERT(m_started);
@@ -1203,22 +1275,28 @@ void VolumeVerifier::Process()
     if (m_hashes_to_calculate.crc32)
     {
       m_crc32_future = std::async(std::launch::async, [this, byte_increment] {
+        const u64 start_us = Common::Timer::NowUs();
         m_crc32_context = Common::UpdateCRC32(m_crc32_context, m_data.data(),
                                               static_cast<size_t>(byte_increment));
+        m_timings.crc32_us += Common::Timer::NowUs() - start_us;
       });
     }
 
     if (m_hashes_to_calculate.md5)
     {
       m_md5_future = std::async(std::launch::async, [this, byte_increment] {
+        const u64 start_us = Common::Timer::NowUs();
         mbedtls_md5_update_ret(&m_md5_context, m_data.data(), byte_increment);
+        m_timings.md5_us += Common::Timer::NowUs() - start_us;
       });
     }
 
     if (m_hashes_to_calculate.sha1)
     {
       m_sha1_future = std::async(std::launch::async, [this, byte_increment] {
+        const u64 start_us = Common::Timer::NowUs();
         m_sha1_context->Update(m_data.data(), byte_increment);
+        m_timings.sha1_us += Common::Timer::NowUs() - start_us;
       });
     }
   }
@@ -1226,10 +1304,12 @@ void VolumeVerifier::Process()
   if (content_read)
   {
     m_content_future = std::async(std::launch::async, [this, read_failed, content] {
+      const u64 start_us = Common::Timer::NowUs();
       if (read_failed || !m_volume.CheckContentIntegrity(content, m_data, m_ticket))
       {
         AddProblem(Severity::High, Common::FmtFormatT("Content {0:08x} is corrupt.", content.id));
       }
+      m_timings.content_check_us += Common::Timer::NowUs() - start_us;
     });
 
     m_content_index++;
@@ -1239,33 +1319,9 @@ void VolumeVerifier::Process()
   {
     m_group_future = std::async(std::launch::async, [this, read_failed,
                                                      group_index = m_group_index] {
-      const GroupToVerify& group = m_groups[group_index];
-      u64 offset_in_group = 0;
-      for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
-           ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
-      {
-        const u64 block_offset = group.offset + offset_in_group;
-
-        if (!read_failed && m_volume.CheckBlockIntegrity(
-                                block_index, m_data.data() + offset_in_group, group.partition))
-        {
-          m_biggest_verified_offset =
-              std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
-        }
-        else
-        {
-          if (m_scrubber.CanBlockBeScrubbed(block_offset))
-          {
-            WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block_offset);
-            m_unused_block_errors[group.partition]++;
-          }
-          else
-          {
-            WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block_offset);
-            m_block_errors[group.partition]++;
-          }
-        }
-      }
+      const u64 start_us = Common::Timer::NowUs();
+      CheckGroup(m_groups[group_index], read_failed);
+      m_timings.block_check_us += Common::Timer::NowUs() - start_us;
     });
 
     m_group_index++;
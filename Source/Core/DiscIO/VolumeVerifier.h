@@ -124,6 +124,20 @@ public:
     RedumpVerifier::Result redump;
   };
 
+  // Time spent in each part of the verification, in microseconds. Reading happens on the thread
+  // that calls Process, and waiting is the time that thread spends waiting for the other parts,
+  // which run on other threads at the same time as the next read.
+  struct StageTimings
+  {
+    u64 read_us = 0;
+    u64 wait_us = 0;
+    u64 crc32_us = 0;
+    u64 md5_us = 0;
+    u64 sha1_us = 0;
+    u64 content_check_us = 0;
+    u64 block_check_us = 0;
+  };
+
   VolumeVerifier(const Volume& volume, bool redump_verification, Hashes<bool> hashes_to_calculate);
   ~VolumeVerifier();
 
@@ -134,6 +148,8 @@ public:
   u64 GetTotalBytes() const;
   void Finish();
   const Result& GetResult() const;
+  // Only complete once Finish has been called.
+  const StageTimings& GetStageTimings() const { return m_timings; }
 
 private:
   struct GroupToVerify
@@ -158,6 +174,7 @@ private:
   void SetUpHashing();
   void WaitForAsyncOperations() const;
   bool ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read);
+  void CheckGroup(const GroupToVerify& group, bool read_failed);
 
   void AddProblem(Severity severity, std::string text);
 
@@ -181,6 +198,8 @@ private:
 
   u64 m_excess_bytes = 0;
   std::vector<u8> m_data;
+  // The next chunk is read into this buffer while the async operations are using m_data
+  std::vector<u8> m_next_data;
   std::future<void> m_crc32_future;
   std::future<void> m_md5_future;
   std::future<void> m_sha1_future;
@@ -199,6 +218,8 @@ private:
   u64 m_biggest_referenced_offset = 0;
   u64 m_biggest_verified_offset = 0;
 
+  StageTimings m_timings;
+
   bool m_started = false;
   bool m_done = false;
   u64 m_progress = 0;
@@ -6,11 +6,13 @@
 #include <algorithm>
 #include <array>
 #include <cstring>
+#include <future>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -40,6 +42,15 @@
 
 namespace DiscIO
 {
+// How much decompressed data to keep around, and how far ahead of sequential reads to decompress.
+// Chunks are at most 2 MiB, so both limits leave room for several chunks in the worst case.
+constexpr u64 CHUNK_CACHE_BYTES = 32 * 1024 * 1024;
+constexpr u64 MAX_CACHED_CHUNKS = 32;
+constexpr u64 READ_AHEAD_BYTES = 4 * 1024 * 1024;
+constexpr u64 MAX_READ_AHEAD_GROUPS = 8;
+constexpr u32 SEQUENTIAL_GROUPS_BEFORE_READ_AHEAD = 2;
+constexpr size_t MAX_READ_AHEAD_THREADS = 4;
+
 static void PushBack(std::vector<u8>* vector, const u8* begin, const u8* end)
 {
   const size_t offset_in_vector = vector->size();
@@ -85,7 +96,13 @@ WIARVZFileReader<RVZ>::WIARVZFileReader(File::IOFile file, const std::string& pa
 }
 
 template <bool RVZ>
-WIARVZFileReader<RVZ>::~WIARVZFileReader() = default;
+WIARVZFileReader<RVZ>::~WIARVZFileReader()
+{
+  // Don't bother finishing read-ahead that nobody is going to use. Destroying the workers waits
+  // for any job that already is running, and each job holds its own reference to the state.
+  for (auto& worker : m_read_ahead_workers)
+    worker->Cancel();
+}
 
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
@@ -149,6 +166,10 @@ bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
     return false;
   }
 
+  m_read_ahead_groups = std::clamp<u64>(READ_AHEAD_BYTES / chunk_size, 1, MAX_READ_AHEAD_GROUPS);
+  m_max_cached_chunks =
+      std::clamp<u64>(CHUNK_CACHE_BYTES / chunk_size, m_read_ahead_groups + 2, MAX_CACHED_CHUNKS);
+
   const u32 compression_type = Common::swap32(m_header_2.compression_type);
   m_compression_type = static_cast<WIARVZCompressionType>(compression_type);
   if (m_compression_type > (RVZ ? WIARVZCompressionType::Zstd : WIARVZCompressionType::LZMA2) ||
@@ -292,6 +313,18 @@ std::unique_ptr<BlobReader> WIARVZFileReader<RVZ>::CopyReader() const
   return Create(m_file.Duplicate("rb"), m_path);
 }
 
+template <bool RVZ>
+std::optional<BlobCacheStatistics> WIARVZFileReader<RVZ>::GetCacheStatistics() const
+{
+  const WiiEncryptionCache::Statistics encryption = m_encryption_cache.GetStatistics();
+  return BlobCacheStatistics{.hits = m_cache_hits.load(std::memory_order_relaxed),
+                             .read_ahead_hits = m_read_ahead_hits.load(std::memory_order_relaxed),
+                             .misses = m_cache_misses.load(std::memory_order_relaxed),
+                             .encrypted_group_hits = encryption.hits,
+                             .encrypted_group_misses = encryption.misses,
+                             .encrypted_group_thrashes = encryption.thrashes};
+}
+
 template <bool RVZ>
 std::string WIARVZFileReader<RVZ>::GetCompressionMethod() const
 {
@@ -500,6 +533,7 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
   data_offset -= skipped_data;
   data_size += skipped_data;
 
+  const u64 full_chunk_size = chunk_size;
   const u64 start_group_index = (*offset - data_offset) / chunk_size;
   for (u64 i = start_group_index; i < number_of_groups && (*size) > 0; ++i)
   {
@@ -507,6 +541,17 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
     if (total_group_index >= m_group_entries.size())
       return false;
 
+    bool read_ahead = false;
+    if (total_group_index != m_last_group_index)
+    {
+      if (total_group_index == m_last_group_index + 1)
+        ++m_sequential_groups;
+      else
+        m_sequential_groups = 0;
+      m_last_group_index = total_group_index;
+      read_ahead = m_sequential_groups >= SEQUENTIAL_GROUPS_BEFORE_READ_AHEAD;
+    }
+
     const GroupEntry group = m_group_entries[total_group_index];
     const u64 group_offset_in_data = i * chunk_size;
     const u64 offset_in_group = *offset - group_offset_in_data - data_offset;
@@ -514,35 +559,21 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
     chunk_size = std::min(chunk_size, data_size - group_offset_in_data);
 
     const u64 bytes_to_read = std::min(chunk_size - offset_in_group, *size);
-    u32 group_data_size = Common::swap32(group.data_size);
-
-    WIARVZCompressionType compression_type = m_compression_type;
-    u32 rvz_packed_size = 0;
-    if constexpr (RVZ)
-    {
-      if ((group_data_size & 0x80000000) == 0)
-        compression_type = WIARVZCompressionType::None;
-
-      group_data_size &= 0x7FFFFFFF;
-
-      rvz_packed_size = Common::swap32(group.rvz_packed_size);
-    }
+    const GroupReadParameters parameters = GetGroupReadParameters(group);
 
-    if (group_data_size == 0)
+    if (parameters.compressed_size == 0)
     {
       std::memset(*out_ptr, 0, bytes_to_read);
     }
     else
     {
-      const u64 group_offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
-
-      Chunk& chunk =
-          ReadCompressedData(group_offset_in_file, group_data_size, chunk_size, compression_type,
-                             exception_lists, rvz_packed_size, group_offset_in_data);
+      Chunk& chunk = ReadCompressedData(parameters.offset_in_file, parameters.compressed_size,
+                                        chunk_size, parameters.compression_type, exception_lists,
+                                        parameters.rvz_packed_size, group_offset_in_data);
 
       if (!chunk.Read(offset_in_group, bytes_to_read, *out_ptr))
       {
-        m_cached_chunk_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
+        RemoveCachedChunk(parameters.offset_in_file);
         return false;
       }
 
@@ -557,6 +588,9 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
       }
     }
 
+    if (read_ahead)
+      ReadAhead(full_chunk_size, data_size, group_index, number_of_groups, exception_lists, i + 1);
+
     *offset += bytes_to_read;
     *size -= bytes_to_read;
     *out_ptr += bytes_to_read;
@@ -572,9 +606,61 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
                                           WIARVZCompressionType compression_type,
                                           u32 exception_lists, u32 rvz_packed_size, u64 data_offset)
 {
-  if (offset_in_file == m_cached_chunk_offset)
-    return m_cached_chunk;
+  for (CachedChunk& cached_chunk : m_cached_chunks)
+  {
+    if (cached_chunk.offset_in_file == offset_in_file)
+    {
+      m_cache_hits.fetch_add(1, std::memory_order_relaxed);
+      cached_chunk.last_used = ++m_cache_clock;
+      return *cached_chunk.chunk;
+    }
+  }
+
+  if (std::shared_ptr<Chunk> chunk = TakeReadAheadChunk(offset_in_file))
+  {
+    m_read_ahead_hits.fetch_add(1, std::memory_order_relaxed);
+    InsertCachedChunk(offset_in_file, chunk);
+    return *chunk;
+  }
+
+  m_cache_misses.fetch_add(1, std::memory_order_relaxed);
+  std::shared_ptr<Chunk> chunk =
+      CreateChunk(&m_file, offset_in_file, compressed_size, decompressed_size, compression_type,
+                  exception_lists, rvz_packed_size, data_offset);
+  InsertCachedChunk(offset_in_file, chunk);
+  return *chunk;
+}
+
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::GroupReadParameters
+WIARVZFileReader<RVZ>::GetGroupReadParameters(const GroupEntry& group) const
+{
+  GroupReadParameters parameters{
+      .offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2,
+      .compressed_size = Common::swap32(group.data_size),
+      .compression_type = m_compression_type,
+      .rvz_packed_size = 0,
+  };
+
+  if constexpr (RVZ)
+  {
+    if ((parameters.compressed_size & 0x80000000) == 0)
+      parameters.compression_type = WIARVZCompressionType::None;
+
+    parameters.compressed_size &= 0x7FFFFFFF;
 
+    parameters.rvz_packed_size = Common::swap32(group.rvz_packed_size);
+  }
+
+  return parameters;
+}
+
+template <bool RVZ>
+std::unique_ptr<typename WIARVZFileReader<RVZ>::Chunk>
+WIARVZFileReader<RVZ>::CreateChunk(File::IOFile* file, u64 offset_in_file, u64 compressed_size,
+                                   u64 decompressed_size, WIARVZCompressionType compression_type,
+                                   u32 exception_lists, u32 rvz_packed_size, u64 data_offset) const
+{
   std::unique_ptr<Decompressor> decompressor;
   switch (compression_type)
   {
@@ -603,11 +689,146 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
 
   const bool compressed_exception_lists = compression_type > WIARVZCompressionType::Purge;
 
-  m_cached_chunk =
-      Chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
-            compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
-  m_cached_chunk_offset = offset_in_file;
-  return m_cached_chunk;
+  return std::make_unique<Chunk>(file, offset_in_file, compressed_size, decompressed_size,
+                                 exception_lists, compressed_exception_lists, rvz_packed_size,
+                                 data_offset, std::move(decompressor));
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::InsertCachedChunk(u64 offset_in_file, std::shared_ptr<Chunk> chunk)
+{
+  if (m_cached_chunks.size() >= m_max_cached_chunks)
+  {
+    m_cached_chunks.erase(std::ranges::min_element(m_cached_chunks, {}, &CachedChunk::last_used));
+  }
+
+  m_cached_chunks.push_back({offset_in_file, std::move(chunk), ++m_cache_clock});
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::RemoveCachedChunk(u64 offset_in_file)
+{
+  std::erase_if(m_cached_chunks, [offset_in_file](const CachedChunk& cached_chunk) {
+    return cached_chunk.offset_in_file == offset_in_file;
+  });
+}
+
+template <bool RVZ>
+std::shared_ptr<typename WIARVZFileReader<RVZ>::Chunk>
+WIARVZFileReader<RVZ>::TakeReadAheadChunk(u64 offset_in_file)
+{
+  ReadAheadState& state = *m_read_ahead_state;
+  std::unique_lock lk(state.mutex);
+
+  const auto it = state.entries.find(offset_in_file);
+  if (it == state.entries.end())
+    return nullptr;
+
+  // The chunk is already being decompressed, so waiting is never slower than starting over
+  state.done_cv.wait(lk, [&] { return it->second.done; });
+
+  std::shared_ptr<Chunk> chunk = it->second.success ? std::move(it->second.chunk) : nullptr;
+  state.entries.erase(it);
+  return chunk;
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::ReadAhead(u64 chunk_size, u64 data_size, u32 group_index,
+                                      u32 number_of_groups, u32 exception_lists, u64 first_group)
+{
+  const u64 last_group = std::min<u64>(first_group + m_read_ahead_groups, number_of_groups);
+
+  struct Job
+  {
+    u64 offset_in_file;
+    std::shared_ptr<Chunk> chunk;
+  };
+  std::vector<Job> jobs;
+
+  for (u64 i = first_group; i < last_group; ++i)
+  {
+    const u64 total_group_index = group_index + i;
+    if (total_group_index >= m_group_entries.size())
+      break;
+
+    const GroupReadParameters parameters =
+        GetGroupReadParameters(m_group_entries[total_group_index]);
+    if (parameters.compressed_size == 0)
+      continue;
+
+    const auto is_cached = [&](const CachedChunk& cached_chunk) {
+      return cached_chunk.offset_in_file == parameters.offset_in_file;
+    };
+    if (std::ranges::any_of(m_cached_chunks, is_cached))
+      continue;
+
+    const u64 group_offset_in_data = i * chunk_size;
+    const u64 decompressed_size = std::min(chunk_size, data_size - group_offset_in_data);
+
+    jobs.push_back({parameters.offset_in_file,
+                    CreateChunk(nullptr, parameters.offset_in_file, parameters.compressed_size,
+                                decompressed_size, parameters.compression_type, exception_lists,
+                                parameters.rvz_packed_size, group_offset_in_data)});
+  }
+
+  ReadAheadState& state = *m_read_ahead_state;
+  {
+    std::lock_guard lk(state.mutex);
+
+    // Finished chunks that the reads have moved past without using are dropped here
+    std::erase_if(state.entries, [&](const auto& entry) {
+      return entry.second.done && std::ranges::none_of(jobs, [&](const Job& job) {
+               return job.offset_in_file == entry.first;
+             });
+    });
+
+    std::erase_if(jobs, [&](const Job& job) { return state.entries.contains(job.offset_in_file); });
+    for (const Job& job : jobs)
+      state.entries.try_emplace(job.offset_in_file);
+  }
+
+  if (jobs.empty())
+    return;
+
+  if (m_read_ahead_workers.empty())
+  {
+    const size_t hardware_threads = std::max(std::thread::hardware_concurrency(), 2u);
+    const size_t num_workers =
+        std::min({MAX_READ_AHEAD_THREADS, hardware_threads / 2,
+                  static_cast<size_t>(m_read_ahead_groups)});
+    for (size_t i = 0; i < num_workers; ++i)
+    {
+      m_read_ahead_workers.push_back(std::make_unique<Common::AsyncWorkThreadSP>(
+          RVZ ? "RVZ read-ahead" : "WIA read-ahead"));
+    }
+  }
+
+  for (Job& job : jobs)
+  {
+    auto& worker = m_read_ahead_workers[m_next_read_ahead_worker];
+    m_next_read_ahead_worker = (m_next_read_ahead_worker + 1) % m_read_ahead_workers.size();
+
+    worker->Push([state = m_read_ahead_state, path = m_path, offset = job.offset_in_file,
+                  chunk = std::move(job.chunk)] {
+      // The reader's own file handle is in use by the emulated reads, so open a separate one
+      File::IOFile file(path, "rb");
+      chunk->SetFile(&file);
+      const bool success = file.IsOpen() && chunk->DecompressAll();
+      chunk->SetFile(nullptr);
+
+      {
+        std::lock_guard lk(state->mutex);
+        const auto it = state->entries.find(offset);
+        if (it != state->entries.end())
+        {
+          it->second.chunk = chunk;
+          it->second.success = success;
+          it->second.done = true;
+        }
+      }
+      state->done_cv.notify_all();
+    });
+  }
 }
 
 template <bool RVZ>
@@ -651,16 +872,35 @@ WIARVZFileReader<RVZ>::Chunk::Chunk(File::IOFile* file, u64 offset_in_file, u64
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
 {
-  if (!m_decompressor || !m_file ||
-      offset + size > m_out.data.size() - m_out_bytes_allocated_for_exceptions)
-  {
+  if (!m_decompressor || offset + size > m_out.data.size() - m_out_bytes_allocated_for_exceptions)
     return false;
-  }
 
-  while (offset + size > GetOutBytesWrittenExcludingExceptions())
+  if (!DecompressUntil(offset + size))
+    return false;
+
+  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
+  return true;
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressAll()
+{
+  if (!m_decompressor)
+    return false;
+
+  return DecompressUntil(m_out.data.size() - m_out_bytes_allocated_for_exceptions);
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressUntil(u64 end)
+{
+  while (end > GetOutBytesWrittenExcludingExceptions())
   {
+    if (!m_file)
+      return false;
+
     u64 bytes_to_read;
-    if (offset + size == m_out.data.size())
+    if (end == m_out.data.size())
     {
       // Read all the remaining data.
       bytes_to_read = m_in.data.size() - m_in.bytes_written;
@@ -673,7 +913,7 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
 
       // The compressed data is probably not much bigger than the decompressed data.
       // Add a few bytes for possible compression overhead and for any hash exceptions.
-      bytes_to_read = offset + size - GetOutBytesWrittenExcludingExceptions() + 0x100;
+      bytes_to_read = end - GetOutBytesWrittenExcludingExceptions() + 0x100;
 
       // Align the access in an attempt to gain speed. But we don't actually know the
       // block size of the underlying storage device, so we just use the Wii block size.
@@ -753,7 +993,6 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
     }
   }
 
-  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
   return true;
 }
 
@@ -1741,7 +1980,8 @@ template <bool RVZ>
 ConversionResultCode
 WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                File::IOFile* outfile, WIARVZCompressionType compression_type,
-                               int compression_level, int chunk_size, CompressCB callback)
+                               int compression_level, int chunk_size, CompressCB callback,
+                               const ConversionLimits& limits)
 {
   ASSERT(infile->GetDataSizeType() == DataSizeType::Accurate);
   ASSERT(chunk_size > 0);
@@ -1847,8 +2087,58 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
                        bytes_written, total_groups, iso_size, callback);
   };
 
+  // Each compression thread can hold one input buffer and one output buffer, and its compressor
+  // and decryption buffers are of a similar size. One more input buffer is used for read-ahead.
+  const u64 max_read_size = std::max<u64>(chunk_size, VolumeWii::GROUP_TOTAL_SIZE);
+  size_t threads = limits.threads != 0 ?
+                       limits.threads :
+                       MultithreadedCompressor<CompressThreadState, CompressParameters,
+                                               OutputParameters>::GetDefaultThreadCount();
+  if (limits.memory != 0)
+  {
+    const u64 buffers = limits.memory / max_read_size;
+    threads = std::clamp<u64>(buffers > 1 ? (buffers - 1) / 3 : 0, 1, threads);
+  }
+
   MultithreadedCompressor<CompressThreadState, CompressParameters, OutputParameters> mt_compressor(
-      set_up_compress_thread_state, process_and_compress, output);
+      set_up_compress_thread_state, process_and_compress, output, threads);
+
+  // The input is read one step ahead on another thread, so that reading overlaps with waiting for
+  // a compression thread to become available. Only one read is in flight at a time.
+  std::optional<CompressParameters> pending_parameters;
+  std::future<bool> pending_read;
+
+  const auto submit_pending = [&] {
+    if (!pending_parameters)
+      return true;
+    if (!pending_read.get())
+      return false;
+    CompressParameters parameters = std::move(*pending_parameters);
+    pending_parameters.reset();
+    mt_compressor.CompressAndWrite(std::move(parameters));
+    return true;
+  };
+
+  const auto read_and_compress = [&](CompressParameters parameters, u64 offset, u64 size) {
+    std::optional<CompressParameters> ready;
+    if (pending_parameters)
+    {
+      if (!pending_read.get())
+        return false;
+      ready = std::move(pending_parameters);
+    }
+
+    pending_parameters = std::move(parameters);
+    pending_parameters->data.resize(size);
+    pending_read = std::async(std::launch::async,
+                              [infile, offset, size, out = pending_parameters->data.data()] {
+                                return infile->Read(offset, size, out);
+                              });
+
+    if (ready)
+      mt_compressor.CompressAndWrite(std::move(*ready));
+    return true;
+  };
 
   for (const DataEntry& data_entry : data_entries)
   {
@@ -1909,14 +2199,17 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
         bytes_to_read = std::max<u64>(bytes_to_read, VolumeWii::GROUP_TOTAL_SIZE);
       bytes_to_read = std::min<u64>(bytes_to_read, data_offset + data_size - bytes_read);
 
-      buffer.resize(bytes_to_read);
-      if (!infile->Read(bytes_read, bytes_to_read, buffer.data()))
+      if (!read_and_compress(CompressParameters{{},
+                                                &data_entry,
+                                                data_offset_in_partition,
+                                                bytes_read + bytes_to_read,
+                                                groups_processed},
+                             bytes_read, bytes_to_read))
+      {
         return ConversionResultCode::ReadFailed;
+      }
       bytes_read += bytes_to_read;
 
-      mt_compressor.CompressAndWrite(CompressParameters{
-          buffer, &data_entry, data_offset_in_partition, bytes_read, groups_processed});
-
       data_offset += bytes_to_read;
       data_size -= bytes_to_read;
 
@@ -1936,6 +2229,9 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
     ASSERT(data_size == 0);
   }
 
+  if (!submit_pending())
+    return ConversionResultCode::ReadFailed;
+
   ASSERT(groups_processed == total_groups);
   ASSERT(bytes_read == iso_size);
 
@@ -2040,7 +2336,8 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
 bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
-                       int chunk_size, const CompressCB& callback)
+                       int chunk_size, const CompressCB& callback,
+                       const ConversionLimits& limits)
 {
   File::IOFile outfile(outfile_path, "wb");
   if (!outfile)
@@ -2058,7 +2355,7 @@ bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
   const auto convert = rvz ? RVZFileReader::Convert : WIAFileReader::Convert;
   const ConversionResultCode result =
       convert(infile, infile_volume.get(), &outfile, compression_type, compression_level,
-              chunk_size, callback);
+              chunk_size, callback, limits);
 
   if (result == ConversionResultCode::ReadFailed)
     PanicAlertFmtT("Failed to read from the input file \"{0}\".", infile_path);
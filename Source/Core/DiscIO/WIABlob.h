@@ -4,17 +4,22 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
 #include "Common/IOFile.h"
 #include "Common/Swap.h"
+#include "Common/WorkQueueThread.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/MultithreadedCompressor.h"
 #include "DiscIO/WIACompression.h"
@@ -62,6 +67,7 @@ public:
   {
     return static_cast<int>(static_cast<s32>(Common::swap32(m_header_2.compression_level)));
   }
+  std::optional<BlobCacheStatistics> GetCacheStatistics() const override;
 
   bool Read(u64 offset, u64 size, u8* out_ptr) override;
   bool SupportsReadWiiDecrypted(u64 offset, u64 size, u64 partition_data_offset) const override;
@@ -69,7 +75,8 @@ public:
 
   static ConversionResultCode Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                       File::IOFile* outfile, WIARVZCompressionType compression_type,
-                                      int compression_level, int chunk_size, CompressCB callback);
+                                      int compression_level, int chunk_size, CompressCB callback,
+                                      const ConversionLimits& limits = {});
 
 private:
   using WiiKey = std::array<u8, 16>;
@@ -193,6 +200,10 @@ private:
           u64 data_offset, std::unique_ptr<Decompressor> decompressor);
 
     bool Read(u64 offset, u64 size, u8* out_ptr);
+    bool DecompressAll();
+
+    // Only needed while there still is compressed data left to read
+    void SetFile(File::IOFile* file) { m_file = file; }
 
     // This can only be called once at least one byte of data has been read
     void GetHashExceptions(std::vector<HashExceptionEntry>* exception_list,
@@ -205,6 +216,7 @@ private:
     }
 
   private:
+    bool DecompressUntil(u64 end);
     bool Decompress();
     bool HandleExceptions(const u8* data, size_t bytes_allocated, size_t bytes_written,
                           size_t* bytes_used, bool align);
@@ -241,6 +253,25 @@ private:
                             WIARVZCompressionType compression_type, u32 exception_lists = 0,
                             u32 rvz_packed_size = 0, u64 data_offset = 0);
 
+  struct GroupReadParameters
+  {
+    u64 offset_in_file;
+    u32 compressed_size;
+    WIARVZCompressionType compression_type;
+    u32 rvz_packed_size;
+  };
+  GroupReadParameters GetGroupReadParameters(const GroupEntry& group) const;
+
+  std::unique_ptr<Chunk> CreateChunk(File::IOFile* file, u64 offset_in_file, u64 compressed_size,
+                                     u64 decompressed_size, WIARVZCompressionType compression_type,
+                                     u32 exception_lists, u32 rvz_packed_size,
+                                     u64 data_offset) const;
+  void InsertCachedChunk(u64 offset_in_file, std::shared_ptr<Chunk> chunk);
+  void RemoveCachedChunk(u64 offset_in_file);
+  std::shared_ptr<Chunk> TakeReadAheadChunk(u64 offset_in_file);
+  void ReadAhead(u64 chunk_size, u64 data_size, u32 group_index, u32 number_of_groups,
+                 u32 exception_lists, u64 first_group);
+
   static bool ApplyHashExceptions(const std::vector<HashExceptionEntry>& exception_list,
                                   VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]);
 
@@ -367,10 +398,45 @@ private:
 
   File::IOFile m_file;
   std::string m_path;
-  Chunk m_cached_chunk;
-  u64 m_cached_chunk_offset = std::numeric_limits<u64>::max();
   WiiEncryptionCache m_encryption_cache;
 
+  // Decompressed chunks, evicted in least recently used order
+  struct CachedChunk
+  {
+    u64 offset_in_file;
+    std::shared_ptr<Chunk> chunk;
+    u64 last_used;
+  };
+  std::vector<CachedChunk> m_cached_chunks;
+  u64 m_cache_clock = 0;
+  size_t m_max_cached_chunks = 1;
+
+  // Once a few groups in a row have been read in order, the following groups are decompressed
+  // on worker threads so that they are ready by the time the emulated software asks for them
+  struct ReadAheadState
+  {
+    struct Entry
+    {
+      std::shared_ptr<Chunk> chunk;
+      bool done = false;
+      bool success = false;
+    };
+
+    std::mutex mutex;
+    std::condition_variable done_cv;
+    std::map<u64, Entry> entries;
+  };
+  std::shared_ptr<ReadAheadState> m_read_ahead_state = std::make_shared<ReadAheadState>();
+  std::vector<std::unique_ptr<Common::AsyncWorkThreadSP>> m_read_ahead_workers;
+  size_t m_next_read_ahead_worker = 0;
+  u64 m_read_ahead_groups = 1;
+  u64 m_last_group_index = std::numeric_limits<u64>::max();
+  u32 m_sequential_groups = 0;
+
+  std::atomic<u64> m_cache_hits = 0;
+  std::atomic<u64> m_read_ahead_hits = 0;
+  std::atomic<u64> m_cache_misses = 0;
+
   std::vector<HashExceptionEntry> m_exception_list;
   bool m_write_to_exception_list = false;
   u64 m_exception_list_last_group_index;
@@ -3,20 +3,27 @@
 
 #include "DiscIO/WiiEncryptionCache.h"
 
+#include <algorithm>
 #include <array>
 #include <cstring>
 #include <limits>
 #include <memory>
+#include <utility>
 
 #include "Common/Align.h"
+#include "Common/Assert.h"
 #include "Common/CommonTypes.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/VolumeWii.h"
 
 namespace DiscIO
 {
+// Enough for reads that alternate between a few streams of data (16 MiB in total)
+constexpr size_t MAX_CACHED_GROUPS = 8;
+
 WiiEncryptionCache::WiiEncryptionCache(BlobReader* blob) : m_blob(blob)
 {
+  m_evicted_offsets.fill(std::numeric_limits<u64>::max());
 }
 
 WiiEncryptionCache::~WiiEncryptionCache() = default;
@@ -26,43 +33,61 @@ WiiEncryptionCache::EncryptGroup(u64 offset, u64 partition_data_offset,
                                  u64 partition_data_decrypted_size, const Key& key,
                                  const HashExceptionCallback& hash_exception_callback)
 {
-  // Only allocate memory if this function actually ends up getting called
-  if (!m_cache)
-  {
-    m_cache = std::make_unique<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>>();
-    m_cached_offset = std::numeric_limits<u64>::max();
-  }
-
   ASSERT(offset % VolumeWii::GROUP_TOTAL_SIZE == 0);
   const u64 group_offset_in_partition =
       offset / VolumeWii::GROUP_TOTAL_SIZE * VolumeWii::GROUP_DATA_SIZE;
   const u64 group_offset_on_disc = partition_data_offset + offset;
 
-  if (m_cached_offset != group_offset_on_disc)
+  for (CachedGroup& cached_group : m_cache)
   {
-    std::function<void(VolumeWii::HashBlock * hash_blocks)> hash_exception_callback_2;
-
-    if (hash_exception_callback)
+    if (cached_group.offset_on_disc == group_offset_on_disc)
     {
-      hash_exception_callback_2 =
-          [offset, &hash_exception_callback](
-              VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]) {
-            return hash_exception_callback(hash_blocks, offset);
-          };
+      m_hits.fetch_add(1, std::memory_order_relaxed);
+      cached_group.last_used = ++m_cache_clock;
+      return cached_group.data.get();
     }
+  }
 
-    if (!VolumeWii::EncryptGroup(group_offset_in_partition, partition_data_offset,
-                                 partition_data_decrypted_size, key, m_blob, m_cache.get(),
-                                 hash_exception_callback_2))
-    {
-      m_cached_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
-      return nullptr;
-    }
+  m_misses.fetch_add(1, std::memory_order_relaxed);
+  if (std::ranges::find(m_evicted_offsets, group_offset_on_disc) != m_evicted_offsets.end())
+    m_thrashes.fetch_add(1, std::memory_order_relaxed);
 
-    m_cached_offset = group_offset_on_disc;
+  // Only allocate memory if this function actually ends up getting called. Once the cache is
+  // full, the buffer of the least recently used group is reused.
+  std::unique_ptr<Group> data;
+  if (m_cache.size() < MAX_CACHED_GROUPS)
+  {
+    data = std::make_unique<Group>();
+  }
+  else
+  {
+    const auto least_recently_used = std::ranges::min_element(m_cache, {}, &CachedGroup::last_used);
+    m_evicted_offsets[m_next_evicted_offset] = least_recently_used->offset_on_disc;
+    m_next_evicted_offset = (m_next_evicted_offset + 1) % m_evicted_offsets.size();
+    data = std::move(least_recently_used->data);
+    m_cache.erase(least_recently_used);
   }
 
-  return m_cache.get();
+  std::function<void(VolumeWii::HashBlock * hash_blocks)> hash_exception_callback_2;
+
+  if (hash_exception_callback)
+  {
+    hash_exception_callback_2 =
+        [offset, &hash_exception_callback](
+            VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]) {
+          return hash_exception_callback(hash_blocks, offset);
+        };
+  }
+
+  if (!VolumeWii::EncryptGroup(group_offset_in_partition, partition_data_offset,
+                               partition_data_decrypted_size, key, m_blob, data.get(),
+                               hash_exception_callback_2))
+  {
+    return nullptr;
+  }
+
+  m_cache.push_back({group_offset_on_disc, std::move(data), ++m_cache_clock});
+  return m_cache.back().data.get();
 }
 
 bool WiiEncryptionCache::EncryptGroups(u64 offset, u64 size, u8* out_ptr, u64 partition_data_offset,
@@ -90,4 +115,11 @@ bool WiiEncryptionCache::EncryptGroups(u64 offset, u64 size, u8* out_ptr, u64 pa
   return true;
 }
 
+WiiEncryptionCache::Statistics WiiEncryptionCache::GetStatistics() const
+{
+  return Statistics{.hits = m_hits.load(std::memory_order_relaxed),
+                    .misses = m_misses.load(std::memory_order_relaxed),
+                    .thrashes = m_thrashes.load(std::memory_order_relaxed)};
+}
+
 }  // namespace DiscIO
@@ -4,8 +4,11 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "DiscIO/VolumeWii.h"
@@ -21,15 +24,23 @@ public:
   using HashExceptionCallback = std::function<void(
       VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP], u64 offset)>;
 
+  struct Statistics
+  {
+    u64 hits = 0;
+    u64 misses = 0;
+    // Misses for groups that had been evicted from the cache not long before, which happens when
+    // reads keep switching between more groups than the cache can hold.
+    u64 thrashes = 0;
+  };
+
   // The blob pointer is kept around for the lifetime of this object.
   explicit WiiEncryptionCache(BlobReader* blob);
   ~WiiEncryptionCache();
 
-  WiiEncryptionCache(WiiEncryptionCache&&) = default;
-  WiiEncryptionCache& operator=(WiiEncryptionCache&&) = default;
-
-  // It would be possible to write a custom copy constructor and assignment operator
+  // It would be possible to write custom copy and move constructors and assignment operators
   // for this class, but there has been no reason to do so.
+  WiiEncryptionCache(WiiEncryptionCache&&) = delete;
+  WiiEncryptionCache& operator=(WiiEncryptionCache&&) = delete;
   WiiEncryptionCache(const WiiEncryptionCache&) = delete;
   WiiEncryptionCache& operator=(const WiiEncryptionCache&) = delete;
 
@@ -47,10 +58,32 @@ public:
                      u64 partition_data_decrypted_size, const Key& key,
                      const HashExceptionCallback& hash_exception_callback = {});
 
+  // Thread-safe.
+  Statistics GetStatistics() const;
+
 private:
+  using Group = std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>;
+
+  struct CachedGroup
+  {
+    u64 offset_on_disc;
+    std::unique_ptr<Group> data;
+    u64 last_used;
+  };
+
   BlobReader* m_blob;
-  std::unique_ptr<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>> m_cache;
-  u64 m_cached_offset = 0;
+
+  // Encrypted groups, evicted in least recently used order
+  std::vector<CachedGroup> m_cache;
+  u64 m_cache_clock = 0;
+
+  // Offsets of the most recently evicted groups, used for counting thrashes
+  std::array<u64, 16> m_evicted_offsets;
+  size_t m_next_evicted_offset = 0;
+
+  std::atomic<u64> m_hits = 0;
+  std::atomic<u64> m_misses = 0;
+  std::atomic<u64> m_thrashes = 0;
 };
 
 }  // namespace DiscIO
@@ -53,6 +53,21 @@ GameConfigEdit::GameConfigEdit(QWidget* parent, QString path, bool read_only)
       tr("Tries to translate branches ahead of time, improving performance in most cases. Defaults "
          "to <b>True</b>"));
 
+  AddDescription(
+      QStringLiteral("JITSuperblocks"),
+      tr("Profiles conditional branches in the x86-64 JIT and recompiles hot paths into larger "
+         "blocks that keep registers cached across the branch. Defaults to <b>False</b>"));
+
+  AddDescription(
+      QStringLiteral("JITWarmStart"),
+      tr("Remembers which code the JIT compiled for this game and compiles it ahead of time on "
+         "the next boot, reducing stutter. Defaults to <b>False</b>"));
+
+  AddDescription(
+      QStringLiteral("JITInterpretColdBlocks"),
+      tr("Interprets code the first times it runs and only compiles it once it is executed again, "
+         "reducing stutter when large amounts of code are loaded. Defaults to <b>False</b>"));
+
   AddDescription(QStringLiteral("Gecko"), tr("Section that contains all Gecko cheat codes."));
 
   AddDescription(QStringLiteral("ActionReplay"),
@@ -118,7 +118,7 @@ bool JitBlockProxyModel::filterAcceptsRow(int source_row, const QModelIndex& sou
   }
   if (m_pm_address_covered.has_value())
   {
-    if (!block.physical_addresses.contains(m_pm_address_covered.value()))
+    if (!std::ranges::binary_search(block.physical_addresses, m_pm_address_covered.value()))
       return false;
   }
   return true;
@@ -179,7 +179,8 @@ void JITWidget::ClearDisassembly()
 
 void JITWidget::ShowFreeMemoryStatus()
 {
-  const std::vector memory_stats = m_system.GetJitInterface().GetMemoryStats();
+  auto& jit_interface = m_system.GetJitInterface();
+  const std::vector memory_stats = jit_interface.GetMemoryStats();
   QString message = tr("Free memory:");
   for (const auto& [name, stats] : memory_stats)
   {
@@ -191,6 +192,26 @@ void JITWidget::ShowFreeMemoryStatus()
                        .arg(QtUtils::FromStdString(name))
                        .arg(fragmentation_ratio * 100.0, 0, 'f', 2));
   }
+
+  const JitInvalidationStatistics invalidation_stats =
+      jit_interface.GetLastFrameInvalidationStatistics();
+  // i18n: %1 is the number of icache invalidations during the last frame, %2 is how many of them
+  // were skipped because the cache line held no JIT code, and %3 is the number of JIT blocks
+  // they erased.
+  message.append(tr(" | Last frame: %1 invalidations (%2 skipped), %3 blocks erased")
+                     .arg(invalidation_stats.num_invalidations)
+                     .arg(invalidation_stats.num_skipped)
+                     .arg(invalidation_stats.num_blocks_erased));
+
+  const PowerPC::MMU::TLBStatistics& tlb_stats = m_system.GetMMU().GetLastFrameTLBStatistics();
+  // i18n: %1 and %2 are the number of data and instruction TLB hits and misses during the last
+  // frame, %3 is how many pages were mapped for fastmem, and %4 how many fastmem accesses were
+  // backpatched to slower code.
+  message.append(tr(", TLB %1 hits / %2 misses, %3 pages mapped, %4 backpatches")
+                     .arg(tlb_stats.tlb_hits)
+                     .arg(tlb_stats.tlb_misses)
+                     .arg(tlb_stats.page_table_mappings)
+                     .arg(tlb_stats.backpatches));
   m_status_bar->showMessage(message);
 }
 
@@ -799,7 +799,7 @@ QStringList MainWindow::PromptFileNames()
       this, tr("Select a File"),
       settings.value(QStringLiteral("mainwindow/lastdir"), QString{}).toString(),
       QStringLiteral("%1 (*.elf *.dol *.gcm *.bin *.iso *.tgc *.wbfs *.ciso *.gcz *.wia *.rvz "
-                     "hif_000000.nfs *.wad *.dff *.m3u *.json);;%2 (*)")
+                     "*.dcs hif_000000.nfs *.wad *.dff *.m3u *.json);;%2 (*)")
           .arg(tr("All GC/Wii files"))
           .arg(tr("All Files")));
 
@@ -3,11 +3,16 @@
 
 #include "DolphinTool/ConvertCommand.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
+#include <filesystem>
 #include <iostream>
 #include <limits>
 #include <optional>
+#include <set>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <OptionParser.h>
@@ -15,6 +20,8 @@
 #include <fmt/ostream.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscUtils.h"
 #include "DiscIO/ScrubbedBlob.h"
@@ -53,9 +60,196 @@ static std::optional<DiscIO::BlobType> ParseFormatString(const std::string& form
     return DiscIO::BlobType::WIA;
   else if (format_str == "rvz")
     return DiscIO::BlobType::RVZ;
+  else if (format_str == "dcs")
+    return DiscIO::BlobType::CHUNK_STORE;
   return std::nullopt;
 }
 
+static std::string GetFormatExtension(DiscIO::BlobType format)
+{
+  switch (format)
+  {
+  case DiscIO::BlobType::GCZ:
+    return "gcz";
+  case DiscIO::BlobType::WIA:
+    return "wia";
+  case DiscIO::BlobType::RVZ:
+    return "rvz";
+  case DiscIO::BlobType::CHUNK_STORE:
+    return "dcs";
+  default:
+    return "iso";
+  }
+}
+
+// Returns the same string for different spellings of the same path, as far as that can be
+// determined for paths that don't exist yet.
+static std::string GetComparablePath(const std::string& path)
+{
+  std::error_code error;
+  std::filesystem::path normalized = std::filesystem::weakly_canonical(StringToPath(path), error);
+  if (error)
+    normalized = std::filesystem::absolute(StringToPath(path), error).lexically_normal();
+
+  std::string result = PathToString(normalized);
+#ifdef _WIN32
+  Common::ToLower(&result);
+#endif
+  return result;
+}
+
+namespace
+{
+struct ConversionSettings
+{
+  DiscIO::BlobType format;
+  bool scrub;
+  std::optional<int> block_size;
+  std::optional<DiscIO::WIARVZCompressionType> compression;
+  std::optional<int> compression_level;
+  DiscIO::ConversionLimits limits;
+};
+}  // namespace
+
+static bool ConvertFile(const ConversionSettings& settings, const std::string& input_file_path,
+                        const std::string& output_file_path)
+{
+  const DiscIO::BlobType format = settings.format;
+  const bool scrub = settings.scrub;
+
+  // Open the blob reader
+  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
+  if (!blob_reader)
+  {
+    fmt::print(std::cerr, "Error: The input file could not be opened.\n");
+    return false;
+  }
+
+  // Open the volume
+  const std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
+  if (!volume)
+  {
+    if (scrub)
+    {
+      fmt::print(std::cerr, "Error: Scrubbing is only supported for GC/Wii disc images.\n");
+      return false;
+    }
+
+    fmt::print(std::cerr,
+               "Warning: The input file is not a GC/Wii disc image. Continuing anyway.\n");
+  }
+
+  if (scrub)
+  {
+    if (volume->IsDatelDisc())
+    {
+      fmt::print(std::cerr, "Error: Scrubbing a Datel disc is not supported.\n");
+      return false;
+    }
+
+    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
+
+    if (!blob_reader)
+    {
+      fmt::print(std::cerr, "Error: Unable to process disc image. Try again without --scrub.\n");
+      return false;
+    }
+  }
+
+  if (scrub && format == DiscIO::BlobType::RVZ)
+  {
+    fmt::print(std::cerr, "Warning: Scrubbing an RVZ container does not offer significant space "
+                          "advantages. Continuing anyway.\n");
+  }
+
+  if (scrub && format == DiscIO::BlobType::PLAIN)
+  {
+    fmt::print(std::cerr, "Warning: Scrubbing does not save space when converting to ISO unless "
+                          "using external compression. Continuing anyway.\n");
+  }
+
+  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
+      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
+  {
+    fmt::print(std::cerr, "Warning: Converting Wii disc images to GCZ without scrubbing may not "
+                          "offer space advantages over ISO. Continuing anyway.\n");
+  }
+
+  if (volume && volume->IsNKit())
+  {
+    fmt::print(std::cerr,
+               "Warning: Converting an NKit file, output will still be NKit! Continuing anyway.\n");
+  }
+
+  if (format == DiscIO::BlobType::GCZ && volume &&
+      !DiscIO::IsGCZBlockSizeLegacyCompatible(settings.block_size.value(), volume->GetDataSize()))
+  {
+    fmt::print(std::cerr,
+               "Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file size "
+               "must be an integer multiple of the block size and must not be an integer "
+               "multiple of the block size multiplied by 32. Continuing anyway.\n");
+  }
+
+  // Perform the conversion
+  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
+
+  bool success = false;
+
+  switch (format)
+  {
+  case DiscIO::BlobType::PLAIN:
+  {
+    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
+                                     NOOP_STATUS_CALLBACK);
+    break;
+  }
+
+  case DiscIO::BlobType::GCZ:
+  {
+    u32 sub_type = std::numeric_limits<u32>::max();
+    if (volume)
+    {
+      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
+        sub_type = 0;
+      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
+        sub_type = 1;
+    }
+    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
+                                   settings.block_size.value(), NOOP_STATUS_CALLBACK,
+                                   settings.limits);
+    break;
+  }
+
+  case DiscIO::BlobType::WIA:
+  case DiscIO::BlobType::RVZ:
+  {
+    success = DiscIO::ConvertToWIAOrRVZ(blob_reader.get(), input_file_path, output_file_path,
+                                        format == DiscIO::BlobType::RVZ,
+                                        settings.compression.value(),
+                                        settings.compression_level.value(),
+                                        settings.block_size.value(), NOOP_STATUS_CALLBACK,
+                                        settings.limits);
+    break;
+  }
+
+  case DiscIO::BlobType::CHUNK_STORE:
+  {
+    success = DiscIO::ConvertToChunkStore(blob_reader.get(), input_file_path, output_file_path,
+                                          settings.block_size.value(),
+                                          settings.compression_level.value(), NOOP_STATUS_CALLBACK);
+    break;
+  }
+
+  default:
+  {
+    ASSERT(false);
+    break;
+  }
+  }
+
+  return success;
+}
+
 int ConvertCommand(const std::vector<std::string>& args)
 {
   optparse::OptionParser parser;
@@ -71,21 +265,22 @@ int ConvertCommand(const std::vector<std::string>& args)
 
   parser.add_option("-i", "--input")
       .type("string")
-      .action("store")
-      .help("Path to disc image FILE.")
+      .action("append")
+      .help("Path to disc image FILE. Can be given several times to convert a batch of files.")
       .metavar("FILE");
 
   parser.add_option("-o", "--output")
       .type("string")
       .action("store")
-      .help("Path to the destination FILE.")
+      .help("Path to the destination FILE, or to the destination folder when converting several "
+            "files.")
       .metavar("FILE");
 
   parser.add_option("-f", "--format")
       .type("string")
       .action("store")
       .help("Container format to use. Default is RVZ. [%choices]")
-      .choices({"iso", "gcz", "wia", "rvz"});
+      .choices({"iso", "gcz", "wia", "rvz", "dcs"});
 
   parser.add_option("-s", "--scrub")
       .action("store_true")
@@ -94,8 +289,8 @@ int ConvertCommand(const std::vector<std::string>& args)
   parser.add_option("-b", "--block_size")
       .type("int")
       .action("store")
-      .help("Block size for GCZ/WIA/RVZ formats, as an integer. Suggested value for RVZ: 131072 "
-            "(128 KiB)");
+      .help("Block size for GCZ/WIA/RVZ/DCS formats, as an integer. Suggested value for RVZ and "
+            "DCS: 131072 (128 KiB)");
 
   parser.add_option("-c", "--compression")
       .type("string")
@@ -107,8 +302,23 @@ int ConvertCommand(const std::vector<std::string>& args)
   parser.add_option("-l", "--compression_level")
       .type("int")
       .action("store")
-      .help("Level of compression for the selected method. Ignored if 'none'. Suggested value for "
-            "zstd: 5");
+      .help("Level of compression for the selected method. Ignored if 'none'. DCS always uses "
+            "zstd. Suggested value for zstd: 5");
+
+  parser.add_option("-j", "--jobs")
+      .type("int")
+      .action("store")
+      .help("Optional. Number of files converted at the same time. The compression threads are "
+            "split evenly between them.")
+      .set_default(1);
+
+  parser.add_option("-m", "--memory")
+      .type("int")
+      .action("store")
+      .help("Optional. Approximate amount of memory in MiB that GCZ/WIA/RVZ conversion may use "
+            "for buffering, shared between all jobs. Fewer compression threads are used if "
+            "needed.")
+      .set_default(0);
 
   const optparse::Values& options = parser.parse_args(args);
 
@@ -125,7 +335,7 @@ int ConvertCommand(const std::vector<std::string>& args)
     fmt::print(std::cerr, "Error: No input set\n");
     return EXIT_FAILURE;
   }
-  const std::string& input_file_path = options["input"];
+  const auto& input_file_paths = options.all("input");
 
   // --output
   if (!options.is_set("output"))
@@ -133,7 +343,15 @@ int ConvertCommand(const std::vector<std::string>& args)
     fmt::print(std::cerr, "Error: No output set\n");
     return EXIT_FAILURE;
   }
-  const std::string& output_file_path = options["output"];
+  const std::string& output_path = options["output"];
+
+  const bool batch = input_file_paths.size() > 1;
+  if (batch && !File::IsDirectory(output_path))
+  {
+    fmt::print(std::cerr, "Error: The output must be an existing folder when converting several "
+                          "files\n");
+    return EXIT_FAILURE;
+  }
 
   // --format
   const std::optional<DiscIO::BlobType> format_o = ParseFormatString(options["format"]);
@@ -144,84 +362,20 @@ int ConvertCommand(const std::vector<std::string>& args)
   }
   const DiscIO::BlobType format = format_o.value();
 
-  // Open the blob reader
-  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
-  if (!blob_reader)
-  {
-    fmt::print(std::cerr, "Error: The input file could not be opened.\n");
-    return EXIT_FAILURE;
-  }
-
   // --scrub
   const bool scrub = static_cast<bool>(options.get("scrub"));
 
-  // Open the volume
-  const std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
-  if (!volume)
-  {
-    if (scrub)
-    {
-      fmt::print(std::cerr, "Error: Scrubbing is only supported for GC/Wii disc images.\n");
-      return EXIT_FAILURE;
-    }
-
-    fmt::print(std::cerr,
-               "Warning: The input file is not a GC/Wii disc image. Continuing anyway.\n");
-  }
-
-  if (scrub)
-  {
-    if (volume->IsDatelDisc())
-    {
-      fmt::print(std::cerr, "Error: Scrubbing a Datel disc is not supported.\n");
-      return EXIT_FAILURE;
-    }
-
-    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
-
-    if (!blob_reader)
-    {
-      fmt::print(std::cerr, "Error: Unable to process disc image. Try again without --scrub.\n");
-      return EXIT_FAILURE;
-    }
-  }
-
-  if (scrub && format == DiscIO::BlobType::RVZ)
-  {
-    fmt::print(std::cerr, "Warning: Scrubbing an RVZ container does not offer significant space "
-                          "advantages. Continuing anyway.\n");
-  }
-
-  if (scrub && format == DiscIO::BlobType::PLAIN)
-  {
-    fmt::print(std::cerr, "Warning: Scrubbing does not save space when converting to ISO unless "
-                          "using external compression. Continuing anyway.\n");
-  }
-
-  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
-      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
-  {
-    fmt::print(std::cerr, "Warning: Converting Wii disc images to GCZ without scrubbing may not "
-                          "offer space advantages over ISO. Continuing anyway.\n");
-  }
-
-  if (volume && volume->IsNKit())
-  {
-    fmt::print(std::cerr,
-               "Warning: Converting an NKit file, output will still be NKit! Continuing anyway.\n");
-  }
-
   // --block_size
   std::optional<int> block_size_o;
   if (options.is_set("block_size"))
     block_size_o = static_cast<int>(options.get("block_size"));
 
   if (format == DiscIO::BlobType::GCZ || format == DiscIO::BlobType::WIA ||
-      format == DiscIO::BlobType::RVZ)
+      format == DiscIO::BlobType::RVZ || format == DiscIO::BlobType::CHUNK_STORE)
   {
     if (!block_size_o.has_value())
     {
-      fmt::print(std::cerr, "Error: Block size must be set for GCZ/RVZ/WIA\n");
+      fmt::print(std::cerr, "Error: Block size must be set for GCZ/RVZ/WIA/DCS\n");
       return EXIT_FAILURE;
     }
 
@@ -237,15 +391,6 @@ int ConvertCommand(const std::vector<std::string>& args)
       fmt::print(std::cerr,
                  "Warning: Block size is not ideal for performance. Continuing anyway.\n");
     }
-
-    if (format == DiscIO::BlobType::GCZ && volume &&
-        !DiscIO::IsGCZBlockSizeLegacyCompatible(block_size_o.value(), volume->GetDataSize()))
-    {
-      fmt::print(std::cerr,
-                 "Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file size "
-                 "must be an integer multiple of the block size and must not be an integer "
-                 "multiple of the block size multiplied by 32. Continuing anyway.\n");
-    }
   }
 
   // --compress, --compress_level
@@ -296,58 +441,106 @@ int ConvertCommand(const std::vector<std::string>& args)
     }
   }
 
-  // Perform the conversion
-  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
-
-  bool success = false;
-
-  switch (format)
+  if (format == DiscIO::BlobType::CHUNK_STORE)
   {
-  case DiscIO::BlobType::PLAIN:
-  {
-    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
-                                     NOOP_STATUS_CALLBACK);
-    break;
-  }
+    if (!compression_level_o.has_value())
+    {
+      fmt::print(std::cerr, "Error: Compression level must be set for DCS\n");
+      return EXIT_FAILURE;
+    }
 
-  case DiscIO::BlobType::GCZ:
-  {
-    u32 sub_type = std::numeric_limits<u32>::max();
-    if (volume)
+    const std::pair<int, int> range =
+        DiscIO::GetAllowedCompressionLevels(DiscIO::WIARVZCompressionType::Zstd, false);
+    if (compression_level_o.value() < range.first || compression_level_o.value() > range.second)
     {
-      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
-        sub_type = 0;
-      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
-        sub_type = 1;
+      fmt::print(std::cerr, "Error: Compression level not in acceptable range\n");
+      return EXIT_FAILURE;
     }
-    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
-                                   block_size_o.value(), NOOP_STATUS_CALLBACK);
-    break;
   }
 
-  case DiscIO::BlobType::WIA:
-  case DiscIO::BlobType::RVZ:
+  // --jobs, --memory
+  size_t jobs = std::min<size_t>(std::max(static_cast<int>(options.get("jobs")), 1),
+                                 input_file_paths.size());
+  if (format == DiscIO::BlobType::CHUNK_STORE && jobs > 1)
   {
-    success = DiscIO::ConvertToWIAOrRVZ(blob_reader.get(), input_file_path, output_file_path,
-                                        format == DiscIO::BlobType::RVZ, compression_o.value(),
-                                        compression_level_o.value(), block_size_o.value(),
-                                        NOOP_STATUS_CALLBACK);
-    break;
+    // All disc images in a folder share one chunk store, which only one conversion may append to
+    fmt::print(std::cerr, "Warning: DCS files are converted one at a time. Continuing anyway.\n");
+    jobs = 1;
   }
+  const u64 memory_mib = std::max(static_cast<int>(options.get("memory")), 0);
 
-  default:
+  DiscIO::ConversionLimits limits;
+  limits.threads = std::max<unsigned int>(1, std::thread::hardware_concurrency() /
+                                                      static_cast<unsigned int>(jobs));
+  limits.memory = memory_mib * 1024 * 1024 / jobs;
+
+  const ConversionSettings settings{format, scrub, block_size_o, compression_o,
+                                    compression_level_o, limits};
+
+  const std::vector<std::string> inputs(input_file_paths.begin(), input_file_paths.end());
+  std::vector<std::string> outputs;
+  for (const std::string& input : inputs)
   {
-    ASSERT(false);
-    break;
-  }
+    if (batch)
+    {
+      std::string name;
+      SplitPath(input, nullptr, &name, nullptr);
+      outputs.push_back(fmt::format("{}/{}.{}", output_path, name, GetFormatExtension(format)));
+    }
+    else
+    {
+      outputs.push_back(output_path);
+    }
   }
 
-  if (!success)
+  // Opening an output truncates it, so no output may be an input or another output
+  std::set<std::string> comparable_inputs;
+  for (const std::string& input : inputs)
+    comparable_inputs.insert(GetComparablePath(input));
+
+  std::set<std::string> comparable_outputs;
+  for (const std::string& output : outputs)
   {
-    fmt::print(std::cerr, "Error: Conversion failed\n");
-    return EXIT_FAILURE;
+    const std::string comparable_output = GetComparablePath(output);
+    if (comparable_inputs.contains(comparable_output))
+    {
+      fmt::print(std::cerr, "Error: The output {} would overwrite an input\n", output);
+      return EXIT_FAILURE;
+    }
+    if (!comparable_outputs.insert(comparable_output).second)
+    {
+      fmt::print(std::cerr, "Error: Several inputs would be converted to {}\n", output);
+      return EXIT_FAILURE;
+    }
   }
 
-  return EXIT_SUCCESS;
+  // Perform the conversion
+  std::atomic<size_t> next_input = 0;
+  std::atomic<size_t> failures = 0;
+
+  const auto convert_files = [&] {
+    for (size_t i = next_input++; i < inputs.size(); i = next_input++)
+    {
+      const std::string& output_file_path = outputs[i];
+      if (!ConvertFile(settings, inputs[i], output_file_path))
+      {
+        fmt::print(std::cerr, "Error: Conversion of {} failed\n", inputs[i]);
+        ++failures;
+      }
+      else if (batch)
+      {
+        fmt::print(std::cout, "Converted {} to {}\n", inputs[i], output_file_path);
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < jobs; ++i)
+    threads.emplace_back(convert_files);
+  convert_files();
+  for (std::thread& thread : threads)
+    thread.join();
+
+  return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 }  // namespace DolphinTool
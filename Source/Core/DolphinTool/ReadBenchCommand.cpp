@@ -0,0 +1,168 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/ReadBenchCommand.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Timer.h"
+#include "DiscIO/Blob.h"
+
+namespace DolphinTool
+{
+namespace
+{
+// The drive transfers data in ECC blocks of this size
+constexpr u64 DVD_BLOCK_SIZE = 0x8000;
+
+struct BenchResult
+{
+  double sequential_seconds = 0;
+  u64 sequential_bytes = 0;
+  double random_seconds = 0;
+  u64 random_reads = 0;
+};
+
+std::optional<BenchResult> RunBench(DiscIO::BlobReader* reader, u64 read_size, u64 sequential_size,
+                                    u64 num_random_reads)
+{
+  BenchResult result;
+  std::vector<u8> buffer(read_size);
+  const u64 data_size = reader->GetDataSize();
+
+  // Reads whole files in order, like when a game streams a movie or loads a level
+  const u64 sequential_end = std::min(sequential_size, data_size);
+  u64 start_us = Common::Timer::NowUs();
+  for (u64 offset = 0; offset < sequential_end; offset += read_size)
+  {
+    const u64 size = std::min(read_size, sequential_end - offset);
+    if (!reader->Read(offset, size, buffer.data()))
+      return std::nullopt;
+    result.sequential_bytes += size;
+  }
+  result.sequential_seconds = (Common::Timer::NowUs() - start_us) / 1000000.0;
+
+  // Seeks all over the disc, like when a game loads many small files
+  if (data_size >= read_size)
+  {
+    std::mt19937_64 rng(0);
+    std::uniform_int_distribution<u64> block_dist(0, (data_size - read_size) / DVD_BLOCK_SIZE);
+    start_us = Common::Timer::NowUs();
+    for (u64 i = 0; i < num_random_reads; ++i)
+    {
+      if (!reader->Read(block_dist(rng) * DVD_BLOCK_SIZE, read_size, buffer.data()))
+        return std::nullopt;
+    }
+    result.random_seconds = (Common::Timer::NowUs() - start_us) / 1000000.0;
+    result.random_reads = num_random_reads;
+  }
+
+  return result;
+}
+}  // namespace
+
+int ReadBenchCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: readbench [options]...");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("append")
+      .help("Path to a disc image FILE. Can be given several times to compare formats.")
+      .metavar("FILE");
+
+  parser.add_option("-b", "--block_size")
+      .type("int")
+      .action("store")
+      .help("Optional. Size of each read in bytes.")
+      .set_default(static_cast<int>(DVD_BLOCK_SIZE));
+
+  parser.add_option("-s", "--sequential_size")
+      .type("int")
+      .action("store")
+      .help("Optional. Number of MiB to read in order from the start of the disc.")
+      .set_default(512);
+
+  parser.add_option("-r", "--random_reads")
+      .type("int")
+      .action("store")
+      .help("Optional. Number of reads at random offsets.")
+      .set_default(2000);
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  if (!options.is_set("input"))
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+
+  const u64 read_size = std::max(static_cast<int>(options.get("block_size")), 1);
+  const u64 sequential_size =
+      static_cast<u64>(std::max(static_cast<int>(options.get("sequential_size")), 0)) << 20;
+  const u64 num_random_reads = std::max(static_cast<int>(options.get("random_reads")), 0);
+
+  bool success = true;
+  for (const std::string& path : options.all("input"))
+  {
+    const std::unique_ptr<DiscIO::BlobReader> reader = DiscIO::CreateBlobReader(path);
+    if (!reader)
+    {
+      fmt::print(std::cerr, "Error: Unable to open {}\n", path);
+      success = false;
+      continue;
+    }
+
+    std::string format = DiscIO::GetName(reader->GetBlobType(), false);
+    const std::string compression = reader->GetCompressionMethod();
+    if (!compression.empty())
+      format += fmt::format(" ({})", compression);
+
+    const std::optional<BenchResult> result =
+        RunBench(reader.get(), read_size, sequential_size, num_random_reads);
+    if (!result)
+    {
+      fmt::print(std::cerr, "Error: Reading {} failed\n", path);
+      success = false;
+      continue;
+    }
+
+    fmt::print(std::cout, "{}\n  Format: {}\n", path, format);
+    if (result->sequential_seconds > 0)
+    {
+      fmt::print(std::cout, "  Sequential: {:.1f} MiB/s\n",
+                 result->sequential_bytes / (1024.0 * 1024.0) / result->sequential_seconds);
+    }
+    if (result->random_seconds > 0)
+    {
+      fmt::print(std::cout, "  Random: {:.0f} reads/s ({:.1f} us per read)\n",
+                 result->random_reads / result->random_seconds,
+                 result->random_seconds * 1000000.0 / result->random_reads);
+    }
+    if (const std::optional<DiscIO::BlobCacheStatistics> cache = reader->GetCacheStatistics())
+    {
+      fmt::print(std::cout, "  Cache: {} hits, {} read-ahead hits, {} misses\n", cache->hits,
+                 cache->read_ahead_hits, cache->misses);
+      fmt::print(std::cout, "  Wii encryption cache: {} hits, {} misses, {} thrashes\n",
+                 cache->encrypted_group_hits, cache->encrypted_group_misses,
+                 cache->encrypted_group_thrashes);
+    }
+  }
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+}  // namespace DolphinTool
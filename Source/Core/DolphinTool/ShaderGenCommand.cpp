@@ -0,0 +1,224 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/ShaderGenCommand.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "VideoCommon/GXPipelineTypes.h"
+#include "VideoCommon/GeometryShaderGen.h"
+#include "VideoCommon/PixelShaderGen.h"
+#include "VideoCommon/ShaderGenCommon.h"
+#include "VideoCommon/UberShaderPixel.h"
+#include "VideoCommon/UberShaderVertex.h"
+#include "VideoCommon/VertexShaderGen.h"
+#include "VideoCommon/VideoCommon.h"
+
+namespace DolphinTool
+{
+namespace
+{
+using VideoCommon::SerializedGXPipelineUid;
+
+// Matches the header written by ShaderCache::LoadPipelineUIDCache.
+constexpr u32 UID_CACHE_FILE_MAGIC = 0x44495550;  // PUID
+
+struct GenerationResult
+{
+  u64 num_shaders = 0;
+  u64 num_bytes = 0;
+};
+
+std::optional<std::vector<SerializedGXPipelineUid>> ReadUIDCache(const std::string& path)
+{
+  File::IOFile file(path, "rb");
+  u32 magic;
+  u32 version;
+  if (!file.ReadBytes(&magic, sizeof(magic)) || !file.ReadBytes(&version, sizeof(version)))
+    return std::nullopt;
+
+  if (magic != UID_CACHE_FILE_MAGIC || version != VideoCommon::GX_PIPELINE_UID_VERSION)
+  {
+    fmt::print(std::cerr, "Error: {} is not a version {} pipeline UID cache\n", path,
+               VideoCommon::GX_PIPELINE_UID_VERSION);
+    return std::nullopt;
+  }
+
+  const u64 data_size = file.GetSize() - sizeof(magic) - sizeof(version);
+  std::vector<SerializedGXPipelineUid> uids(data_size / sizeof(SerializedGXPipelineUid));
+  if (!file.ReadArray(uids.data(), uids.size()))
+    return std::nullopt;
+
+  return uids;
+}
+
+std::optional<APIType> ParseAPIType(const std::string& name)
+{
+  if (name == "opengl")
+    return APIType::OpenGL;
+  if (name == "d3d")
+    return APIType::D3D;
+  if (name == "vulkan")
+    return APIType::Vulkan;
+  if (name == "metal")
+    return APIType::Metal;
+  return std::nullopt;
+}
+
+GenerationResult GeneratePipelineShaders(APIType api_type, const ShaderHostConfig& host_config,
+                                         const SerializedGXPipelineUid& uid)
+{
+  GenerationResult result;
+  const auto add = [&result](const ShaderCode& code) {
+    result.num_shaders++;
+    result.num_bytes += code.GetBuffer().size();
+  };
+
+  add(GenerateVertexShaderCode(api_type, host_config, uid.vs_uid.GetUidData(), {}));
+
+  PixelShaderUid ps_uid = uid.ps_uid;
+  ClearUnusedPixelShaderUidBits(api_type, host_config, &ps_uid);
+  add(GeneratePixelShaderCode(api_type, host_config, ps_uid.GetUidData(), {}));
+
+  if (!uid.gs_uid.GetUidData()->IsPassthrough())
+    add(GenerateGeometryShaderCode(api_type, host_config, uid.gs_uid.GetUidData()));
+
+  return result;
+}
+
+GenerationResult GenerateUberShaders(APIType api_type, const ShaderHostConfig& host_config)
+{
+  GenerationResult result;
+  const auto add = [&result](const ShaderCode& code) {
+    result.num_shaders++;
+    result.num_bytes += code.GetBuffer().size();
+  };
+
+  UberShader::EnumerateVertexShaderUids([&](const UberShader::VertexShaderUid& uid) {
+    add(UberShader::GenVertexShader(api_type, host_config, uid.GetUidData()));
+  });
+  UberShader::EnumeratePixelShaderUids([&](const UberShader::PixelShaderUid& uid) {
+    UberShader::PixelShaderUid cleared_uid = uid;
+    UberShader::ClearUnusedPixelShaderUidBits(api_type, host_config, &cleared_uid);
+    add(UberShader::GenPixelShader(api_type, host_config, cleared_uid.GetUidData()));
+  });
+
+  return result;
+}
+}  // namespace
+
+int ShaderGenCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: shadergen [options]...");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to a pipeline UID cache FILE (<game id>.uidcache in the cache folder).")
+      .metavar("FILE");
+
+  parser.add_option("-a", "--api")
+      .type("string")
+      .action("store")
+      .help("Optional. Shading language to generate. [%choices]")
+      .choices({"opengl", "d3d", "vulkan", "metal"})
+      .set_default("vulkan");
+
+  parser.add_option("-t", "--threads")
+      .type("int")
+      .action("store")
+      .help("Optional. Number of threads generating shaders at the same time.")
+      .set_default(1);
+
+  parser.add_option("-r", "--repeat")
+      .type("int")
+      .action("store")
+      .help("Optional. Number of passes over the UID cache.")
+      .set_default(1);
+
+  parser.add_option("-u", "--ubershaders")
+      .action("store_true")
+      .help("Optional. Also generate every vertex and pixel ubershader on each pass.");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  if (!options.is_set("input"))
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+
+  const auto uids = ReadUIDCache(options["input"]);
+  if (!uids)
+  {
+    fmt::print(std::cerr, "Error: Unable to read the UID cache\n");
+    return EXIT_FAILURE;
+  }
+
+  const APIType api_type = *ParseAPIType(options["api"]);
+  const ShaderHostConfig host_config = ShaderHostConfig::GetCurrent();
+  const u32 num_threads = std::max(static_cast<int>(options.get("threads")), 1);
+  const int num_passes = std::max(static_cast<int>(options.get("repeat")), 1);
+  const bool include_ubershaders = options.is_set("ubershaders");
+
+  std::atomic<u64> total_shaders = 0;
+  std::atomic<u64> total_bytes = 0;
+  const auto generate = [&](u32 thread_index) {
+    GenerationResult sum;
+    for (int pass = 0; pass < num_passes; ++pass)
+    {
+      for (size_t i = thread_index; i < uids->size(); i += num_threads)
+      {
+        const GenerationResult result = GeneratePipelineShaders(api_type, host_config, (*uids)[i]);
+        sum.num_shaders += result.num_shaders;
+        sum.num_bytes += result.num_bytes;
+      }
+
+      if (include_ubershaders && thread_index == 0)
+      {
+        const GenerationResult result = GenerateUberShaders(api_type, host_config);
+        sum.num_shaders += result.num_shaders;
+        sum.num_bytes += result.num_bytes;
+      }
+    }
+    total_shaders += sum.num_shaders;
+    total_bytes += sum.num_bytes;
+  };
+
+  const TimePoint start = Clock::now();
+  std::vector<std::thread> threads;
+  for (u32 i = 1; i < num_threads; ++i)
+    threads.emplace_back(generate, i);
+  generate(0);
+  for (std::thread& thread : threads)
+    thread.join();
+  const double seconds = DT_s(Clock::now() - start).count();
+
+  fmt::print(std::cout, "Pipelines: {} x {} passes\n", uids->size(), num_passes);
+  fmt::print(std::cout, "Shaders generated: {} ({:.1f} MiB of source)\n", total_shaders.load(),
+             total_bytes.load() / (1024.0 * 1024.0));
+  fmt::print(std::cout, "Time: {:.3f} s on {} thread(s)\n", seconds, num_threads);
+  if (seconds > 0)
+  {
+    fmt::print(std::cout, "Throughput: {:.0f} shaders/s, {:.1f} MiB/s\n",
+               total_shaders.load() / seconds, total_bytes.load() / (1024.0 * 1024.0) / seconds);
+  }
+
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -5,6 +5,7 @@
 
 #include <cstdlib>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <OptionParser.h>
@@ -12,6 +13,7 @@
 #include <fmt/ostream.h>
 
 #include "Common/StringUtil.h"
+#include "Common/Timer.h"
 #include "Core/AchievementManager.h"
 #include "DiscIO/Volume.h"
 #include "DiscIO/VolumeVerifier.h"
@@ -74,6 +76,30 @@ static void PrintFullReport(const DiscIO::VolumeVerifier::Result& result)
   }
 }
 
+static void PrintTimings(const DiscIO::VolumeVerifier& verifier, u64 elapsed_us)
+{
+  const double seconds = elapsed_us / 1000000.0;
+  const double mib = verifier.GetBytesProcessed() / (1024.0 * 1024.0);
+  fmt::print(std::cout, "Verified {:.1f} MiB in {:.2f} s", mib, seconds);
+  if (seconds > 0)
+    fmt::print(std::cout, " ({:.1f} MiB/s)", mib / seconds);
+  fmt::print(std::cout, "\n");
+
+  // All stages except reading and waiting run in parallel with each other and with reading
+  const DiscIO::VolumeVerifier::StageTimings& timings = verifier.GetStageTimings();
+  const auto print_stage = [](std::string_view name, u64 us) {
+    if (us != 0)
+      fmt::print(std::cout, "  {}: {:.2f} s\n", name, us / 1000000.0);
+  };
+  print_stage("Reading", timings.read_us);
+  print_stage("Waiting for other stages", timings.wait_us);
+  print_stage("CRC32", timings.crc32_us);
+  print_stage("MD5", timings.md5_us);
+  print_stage("SHA1", timings.sha1_us);
+  print_stage("Content checks", timings.content_check_us);
+  print_stage("Block checks", timings.block_check_us);
+}
+
 int VerifyCommand(const std::vector<std::string>& args)
 {
   optparse::OptionParser parser;
@@ -157,12 +183,14 @@ int VerifyCommand(const std::vector<std::string>& args)
 
   // Verify the volume
   DiscIO::VolumeVerifier verifier(*volume, false, hashes_to_calculate);
+  const u64 start_us = Common::Timer::NowUs();
   verifier.Start();
   while (verifier.GetBytesProcessed() != verifier.GetTotalBytes())
   {
     verifier.Process();
   }
   verifier.Finish();
+  const u64 elapsed_us = Common::Timer::NowUs() - start_us;
   const DiscIO::VolumeVerifier::Result& result = verifier.GetResult();
 
 #ifdef USE_RETRO_ACHIEVEMENTS
@@ -177,6 +205,7 @@ int VerifyCommand(const std::vector<std::string>& args)
   if (!algorithm_is_set)
   {
     PrintFullReport(result);
+    PrintTimings(verifier, elapsed_us);
   }
   else
   {
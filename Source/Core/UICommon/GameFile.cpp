@@ -104,6 +104,9 @@ GameFile::GameFile() = default;
 GameFile::GameFile(std::string path) : m_file_path(std::move(path))
 {
   m_file_name = PathToFileName(m_file_path);
+  const File::SizeAndModificationTime file_info = File::GetSizeAndModificationTime(m_file_path);
+  m_file_disk_size = file_info.size;
+  m_file_modified_time = file_info.modification_time;
 
   {
     std::unique_ptr<DiscIO::Volume> volume(DiscIO::CreateVolume(m_file_path));
@@ -199,6 +202,13 @@ bool GameFile::IsValid() const
   return true;
 }
 
+bool GameFile::IsOutdated() const
+{
+  // Game lists on network storage may hold thousands of files, so each check is a single query
+  const File::SizeAndModificationTime file_info = File::GetSizeAndModificationTime(m_file_path);
+  return file_info.size != m_file_disk_size || file_info.modification_time != m_file_modified_time;
+}
+
 bool GameFile::CustomCoverChanged()
 {
   if (!m_custom_cover.buffer.empty() || !UseGameCovers())
@@ -299,6 +309,8 @@ void GameFile::DoState(PointerWrap& p)
   p.Do(m_file_name);
 
   p.Do(m_file_size);
+  p.Do(m_file_disk_size);
+  p.Do(m_file_modified_time);
   p.Do(m_volume_size);
   p.Do(m_volume_size_type);
   p.Do(m_is_datel_disc);
@@ -57,6 +57,9 @@ public:
   ~GameFile();
 
   bool IsValid() const;
+  // Returns true if the file on disk has a different size or modification time than when this
+  // GameFile was created, which means that it needs to be scanned again.
+  bool IsOutdated() const;
   const std::string& GetFilePath() const { return m_file_path; }
   const std::string& GetFileName() const { return m_file_name; }
   const std::string& GetName(const Core::TitleDatabase& title_database) const;
@@ -147,6 +150,9 @@ private:
   std::string m_file_name;
 
   u64 m_file_size{};
+  // What the file system reported when this GameFile was created
+  u64 m_file_disk_size{};
+  u64 m_file_modified_time{};
   u64 m_volume_size{};
   DiscIO::DataSizeType m_volume_size_type{};
   bool m_is_datel_disc{};
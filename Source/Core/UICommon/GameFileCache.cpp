@@ -4,12 +4,16 @@
 #include "UICommon/GameFileCache.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
 #include <functional>
 #include <list>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -19,21 +23,28 @@
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/Timer.h"
 
+#include "DiscIO/Blob.h"
 #include "DiscIO/DirectoryBlob.h"
 
 #include "UICommon/GameFile.h"
 
 namespace UICommon
 {
-static constexpr u32 CACHE_REVISION = 26;  // Last changed in PR 10084
+static constexpr u32 CACHE_REVISION = 29;  // Last changed for the file modification times
+
+// Scanning is mostly waiting for I/O, which on network storage benefits from more requests in
+// flight than there are cores. This bounds how many files are opened at the same time.
+static constexpr size_t MAX_SCAN_THREADS = 8;
 
 std::vector<std::string> FindAllGamePaths(const std::vector<std::string>& directories_to_scan,
                                           bool recursive_scan)
 {
   static const std::vector<std::string> search_extensions = {
-      ".gcm", ".tgc", ".bin", ".iso", ".ciso", ".gcz", ".wbfs",
-      ".wia", ".rvz", ".nfs", ".wad", ".dol",  ".elf", ".json"};
+      ".gcm", ".tgc", ".bin", ".iso", ".ciso", ".gcz", ".wbfs", ".wia",
+      ".rvz", ".dcs", ".nfs", ".wad", ".dol",  ".elf", ".json"};
 
   // TODO: We could process paths iteratively as they are found
   return Common::DoFileSearch(directories_to_scan, search_extensions, recursive_scan);
@@ -110,8 +121,11 @@ bool GameFileCache::Update(std::span<const std::string> all_game_paths,
       if (processing_halted)
         break;
 
-      if (game_paths.erase((*it)->GetFilePath()))
+      // Files that changed on disk stay in game_paths, so that they get scanned again below
+      const auto path_it = game_paths.find((*it)->GetFilePath());
+      if (path_it != game_paths.end() && !(*it)->IsOutdated())
       {
+        game_paths.erase(path_it);
         ++it;
       }
       else
@@ -128,14 +142,69 @@ bool GameFileCache::Update(std::span<const std::string> all_game_paths,
   }
 
   // Now that the previous loop has run, game_paths only contains paths that
-  // aren't in m_cached_files, so we simply add all of them to m_cached_files.
-  for (const std::string& path : game_paths)
+  // aren't in m_cached_files, so we scan all of them and add the valid ones to m_cached_files.
+  const std::vector<std::string> paths_to_scan(game_paths.begin(), game_paths.end());
+  const size_t num_threads = std::min(paths_to_scan.size(), MAX_SCAN_THREADS);
+
+  struct ScanTime
   {
-    if (processing_halted)
-      break;
+    u64 num_files = 0;
+    u64 time_us = 0;
+  };
+
+  std::atomic<size_t> next_path = 0;
+  std::mutex scanned_mutex;
+  std::condition_variable scanned_cv;
+  std::vector<std::shared_ptr<GameFile>> scanned;
+  size_t num_threads_done = 0;
+  std::map<std::string, ScanTime> scan_times;
+
+  const auto scan = [&] {
+    while (!processing_halted)
+    {
+      const size_t index = next_path++;
+      if (index >= paths_to_scan.size())
+        break;
+
+      const u64 start_us = Common::Timer::NowUs();
+      auto file = std::make_shared<GameFile>(paths_to_scan[index]);
+      const u64 time_us = Common::Timer::NowUs() - start_us;
+
+      std::lock_guard lk(scanned_mutex);
+      ScanTime& scan_time =
+          scan_times[file->IsValid() ? DiscIO::GetName(file->GetBlobType(), false) : "invalid"];
+      ++scan_time.num_files;
+      scan_time.time_us += time_us;
+
+      if (file->IsValid())
+      {
+        scanned.push_back(std::move(file));
+        scanned_cv.notify_one();
+      }
+    }
 
-    auto file = std::make_shared<GameFile>(path);
-    if (file->IsValid())
+    std::lock_guard lk(scanned_mutex);
+    ++num_threads_done;
+    scanned_cv.notify_one();
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < num_threads; ++i)
+    threads.emplace_back(scan);
+
+  // The callbacks are only called on this thread, as games finish scanning
+  std::vector<std::shared_ptr<GameFile>> newly_scanned;
+  while (true)
+  {
+    {
+      std::unique_lock lk(scanned_mutex);
+      scanned_cv.wait(lk, [&] { return !scanned.empty() || num_threads_done == num_threads; });
+      if (scanned.empty())
+        break;
+      std::swap(scanned, newly_scanned);
+    }
+
+    for (std::shared_ptr<GameFile>& file : newly_scanned)
     {
       if (game_added_to_cache)
         game_added_to_cache(file);
@@ -143,6 +212,17 @@ bool GameFileCache::Update(std::span<const std::string> all_game_paths,
       cache_changed = true;
       m_cached_files.push_back(std::move(file));
     }
+    newly_scanned.clear();
+  }
+
+  for (std::thread& thread : threads)
+    thread.join();
+
+  for (const auto& [format, scan_time] : scan_times)
+  {
+    INFO_LOG_FMT(COMMON, "Game list: scanned {} {} files in {} ms ({} us per file)",
+                 scan_time.num_files, format, scan_time.time_us / 1000,
+                 scan_time.time_us / scan_time.num_files);
   }
 
   return cache_changed;
@@ -3,6 +3,8 @@
 
 #include "VideoCommon/AsyncShaderCompiler.h"
 
+#include <algorithm>
+#include <iterator>
 #include <thread>
 
 #include "Common/Assert.h"
@@ -32,40 +34,69 @@ void AsyncShaderCompiler::QueueWorkItem(WorkItemPtr item, u32 priority)
   {
     item->Compile();
     m_completed_work.push_back(std::move(item));
+    m_completed_items++;
+    return;
+  }
+
+  const size_t bucket = std::min<size_t>(priority / PRIORITY_BUCKET_SIZE, NUM_PRIORITY_BUCKETS - 1);
+  WorkerQueue& queue = *m_worker_queues[m_next_worker_queue++ % m_worker_queues.size()];
+  {
+    std::lock_guard<std::mutex> guard(queue.pending_lock);
+    queue.pending[bucket].push_back({std::move(item), Clock::now()});
+    m_bucket_sizes[bucket]++;
+    m_queued_items++;
   }
-  else
+
+  // A worker going to sleep registers itself before checking m_queued_items, so if none is
+  // registered here, any worker about to sleep will see the new item instead.
+  if (m_sleeping_workers.load() != 0)
   {
-    std::lock_guard<std::mutex> guard(m_pending_work_lock);
-    m_pending_work.emplace(priority, std::move(item));
+    {
+      std::lock_guard<std::mutex> guard(m_worker_wake_lock);
+    }
     m_worker_thread_wake.notify_one();
   }
 }
 
 void AsyncShaderCompiler::RetrieveWorkItems()
 {
-  std::deque<WorkItemPtr> completed_work;
-  {
-    std::lock_guard<std::mutex> guard(m_completed_work_lock);
-    m_completed_work.swap(completed_work);
-  }
+  std::vector<WorkItemPtr> completed_work;
+  completed_work.swap(m_completed_work);
 
-  while (!completed_work.empty())
+  for (const auto& queue : m_worker_queues)
   {
-    completed_work.front()->Retrieve();
-    completed_work.pop_front();
+    std::unique_lock<std::mutex> lock(queue->completed_lock, std::try_to_lock);
+    if (!lock.owns_lock())
+      continue;
+
+    std::move(queue->completed.begin(), queue->completed.end(),
+              std::back_inserter(completed_work));
+    queue->completed.clear();
   }
+
+  // Retrieving can queue new work, which may complete synchronously into m_completed_work.
+  m_completed_items -= completed_work.size();
+  for (WorkItemPtr& item : completed_work)
+    item->Retrieve();
 }
 
 bool AsyncShaderCompiler::HasPendingWork()
 {
-  std::lock_guard<std::mutex> guard(m_pending_work_lock);
-  return !m_pending_work.empty() || m_busy_workers.load() != 0;
+  return m_queued_items.load() != 0 || m_busy_workers.load() != 0;
 }
 
 bool AsyncShaderCompiler::HasCompletedWork()
 {
-  std::lock_guard<std::mutex> guard(m_completed_work_lock);
-  return !m_completed_work.empty();
+  return m_completed_items.load() != 0;
+}
+
+AsyncShaderCompiler::QueueStatistics AsyncShaderCompiler::GetQueueStatistics() const
+{
+  return {
+      .num_items = m_num_items_started.load(),
+      .total_wait = DT(m_total_queue_wait.load()),
+      .max_wait = DT(m_max_queue_wait.load()),
+  };
 }
 
 bool AsyncShaderCompiler::WaitUntilCompletion(
@@ -86,24 +117,15 @@ bool AsyncShaderCompiler::WaitUntilCompletion(
   }
 
   // Grab the number of pending items. We use this to work out how many are left.
-  size_t total_items;
-  {
-    // Safe to hold both locks here, since nowhere else does.
-    std::lock_guard<std::mutex> pending_guard(m_pending_work_lock);
-    std::lock_guard<std::mutex> completed_guard(m_completed_work_lock);
-    total_items = m_completed_work.size() + m_pending_work.size() + m_busy_workers.load() + 1;
-  }
+  const size_t total_items =
+      m_completed_items.load() + m_queued_items.load() + m_busy_workers.load() + 1;
 
   // Update progress while the compiles complete.
   while (Core::GetState(Core::System::GetInstance()) != Core::State::Stopping)
   {
-    size_t remaining_items;
-    {
-      std::lock_guard<std::mutex> pending_guard(m_pending_work_lock);
-      if (m_pending_work.empty() && !m_busy_workers.load())
-        return true;
-      remaining_items = m_pending_work.size();
-    }
+    if (!HasPendingWork())
+      return true;
+    const size_t remaining_items = m_queued_items.load();
 
     progress_callback(total_items - remaining_items, total_items);
     std::this_thread::sleep_for(CHECK_INTERVAL);
@@ -116,6 +138,24 @@ bool AsyncShaderCompiler::StartWorkerThreads(u32 num_worker_threads)
   if (num_worker_threads == 0)
     return true;
 
+  // Hand the work left over from the previous workers to the new queues.
+  std::vector<std::unique_ptr<WorkerQueue>> old_queues;
+  old_queues.swap(m_worker_queues);
+  for (u32 i = 0; i < num_worker_threads; i++)
+    m_worker_queues.push_back(std::make_unique<WorkerQueue>());
+  for (const auto& old_queue : old_queues)
+  {
+    for (size_t bucket = 0; bucket < NUM_PRIORITY_BUCKETS; bucket++)
+    {
+      for (PendingWorkItem& pending : old_queue->pending[bucket])
+      {
+        m_worker_queues[m_next_worker_queue++ % num_worker_threads]->pending[bucket].push_back(
+            std::move(pending));
+      }
+    }
+    std::ranges::move(old_queue->completed, std::back_inserter(m_completed_work));
+  }
+
   for (u32 i = 0; i < num_worker_threads; i++)
   {
     void* thread_param = nullptr;
@@ -127,7 +167,7 @@ bool AsyncShaderCompiler::StartWorkerThreads(u32 num_worker_threads)
 
     m_worker_thread_start_result.store(false);
 
-    std::thread thr(&AsyncShaderCompiler::WorkerThreadEntryPoint, this, thread_param);
+    std::thread thr(&AsyncShaderCompiler::WorkerThreadEntryPoint, this, thread_param, size_t{i});
     m_init_event.Wait();
 
     if (!m_worker_thread_start_result.load())
@@ -164,7 +204,7 @@ void AsyncShaderCompiler::StopWorkerThreads()
 
   // Signal worker threads to stop, and wake all of them.
   {
-    std::lock_guard<std::mutex> guard(m_pending_work_lock);
+    std::lock_guard<std::mutex> guard(m_worker_wake_lock);
     m_exit_flag.Set();
     m_worker_thread_wake.notify_all();
   }
@@ -190,7 +230,7 @@ void AsyncShaderCompiler::WorkerThreadExit(void* param)
 {
 }
 
-void AsyncShaderCompiler::WorkerThreadEntryPoint(void* param)
+void AsyncShaderCompiler::WorkerThreadEntryPoint(void* param, size_t worker_index)
 {
   Common::SetCurrentThreadName("AsyncShaderCompiler Worker");
 
@@ -206,35 +246,75 @@ void AsyncShaderCompiler::WorkerThreadEntryPoint(void* param)
   m_worker_thread_start_result.store(true);
   m_init_event.Set();
 
-  WorkerThreadRun();
+  WorkerThreadRun(worker_index);
 
   WorkerThreadExit(param);
 }
 
-void AsyncShaderCompiler::WorkerThreadRun()
+std::optional<AsyncShaderCompiler::PendingWorkItem>
+AsyncShaderCompiler::TakeWorkItem(size_t worker_index)
 {
-  std::unique_lock<std::mutex> pending_lock(m_pending_work_lock);
-  while (!m_exit_flag.IsSet())
+  for (size_t bucket = 0; bucket < NUM_PRIORITY_BUCKETS; bucket++)
   {
-    m_worker_thread_wake.wait(pending_lock);
+    if (m_bucket_sizes[bucket].load() == 0)
+      continue;
 
-    while (!m_pending_work.empty() && !m_exit_flag.IsSet())
+    // Look in our own queue first, then steal from the others.
+    for (size_t i = 0; i < m_worker_queues.size(); i++)
     {
+      WorkerQueue& queue = *m_worker_queues[(worker_index + i) % m_worker_queues.size()];
+      std::lock_guard<std::mutex> guard(queue.pending_lock);
+      auto& items = queue.pending[bucket];
+      if (items.empty())
+        continue;
+
+      PendingWorkItem pending = std::move(items.front());
+      items.pop_front();
+
+      // Count the worker as busy before the item leaves the queue, so HasPendingWork() can't
+      // briefly see neither.
       m_busy_workers++;
-      auto iter = m_pending_work.begin();
-      WorkItemPtr item(std::move(iter->second));
-      m_pending_work.erase(iter);
-      pending_lock.unlock();
+      m_bucket_sizes[bucket]--;
+      m_queued_items--;
+      return pending;
+    }
+  }
 
-      if (item->Compile())
-      {
-        std::lock_guard<std::mutex> completed_guard(m_completed_work_lock);
-        m_completed_work.push_back(std::move(item));
-      }
+  return std::nullopt;
+}
 
-      pending_lock.lock();
-      m_busy_workers--;
+void AsyncShaderCompiler::WorkerThreadRun(size_t worker_index)
+{
+  WorkerQueue& own_queue = *m_worker_queues[worker_index];
+  while (!m_exit_flag.IsSet())
+  {
+    std::optional<PendingWorkItem> pending = TakeWorkItem(worker_index);
+    if (!pending)
+    {
+      std::unique_lock<std::mutex> wake_lock(m_worker_wake_lock);
+      m_sleeping_workers++;
+      m_worker_thread_wake.wait(
+          wake_lock, [this] { return m_queued_items.load() != 0 || m_exit_flag.IsSet(); });
+      m_sleeping_workers--;
+      continue;
     }
+
+    const DT::rep wait = (Clock::now() - pending->queue_time).count();
+    m_num_items_started++;
+    m_total_queue_wait += wait;
+    DT::rep max_wait = m_max_queue_wait.load();
+    while (wait > max_wait && !m_max_queue_wait.compare_exchange_weak(max_wait, wait))
+    {
+    }
+
+    if (pending->item->Compile())
+    {
+      std::lock_guard<std::mutex> guard(own_queue.completed_lock);
+      own_queue.completed.push_back(std::move(pending->item));
+      m_completed_items++;
+    }
+
+    m_busy_workers--;
   }
 }
 
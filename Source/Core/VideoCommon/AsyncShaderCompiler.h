@@ -3,13 +3,14 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <functional>
-#include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -33,6 +34,14 @@ public:
 
   using WorkItemPtr = std::unique_ptr<WorkItem>;
 
+  // Time work items spent queued before a worker picked them up, since the compiler was created.
+  struct QueueStatistics
+  {
+    u64 num_items = 0;
+    DT total_wait{};
+    DT max_wait{};
+  };
+
   AsyncShaderCompiler();
   virtual ~AsyncShaderCompiler();
 
@@ -45,9 +54,12 @@ public:
   // Queues a new work item to the compiler threads. The lower the priority, the sooner
   // this work item will be compiled, relative to the other work items.
   void QueueWorkItem(WorkItemPtr item, u32 priority);
+  // Retrieves completed work items in batches. Batches a worker is currently adding to are left
+  // for the next call rather than waiting for the worker.
   void RetrieveWorkItems();
   bool HasPendingWork();
   bool HasCompletedWork();
+  QueueStatistics GetQueueStatistics() const;
 
   // Calls progress_callback periodically, with completed_items, and total_items.
   // Returns false if interrupted.
@@ -65,8 +77,31 @@ protected:
   virtual void WorkerThreadExit(void* param);
 
 private:
-  void WorkerThreadEntryPoint(void* param);
-  void WorkerThreadRun();
+  // Priorities are grouped into buckets of this many values, which are compiled in FIFO order.
+  // This keeps ShaderCache's on-demand, ubershader and shader cache pipelines apart.
+  static constexpr u32 PRIORITY_BUCKET_SIZE = 100;
+  static constexpr size_t NUM_PRIORITY_BUCKETS = 4;
+
+  struct PendingWorkItem
+  {
+    WorkItemPtr item;
+    TimePoint queue_time;
+  };
+
+  // Every worker owns a queue. New items are spread over the queues, and a worker that runs out
+  // of work in its own queue steals from the others, so the threads rarely share a lock.
+  struct WorkerQueue
+  {
+    std::mutex pending_lock;
+    std::array<std::deque<PendingWorkItem>, NUM_PRIORITY_BUCKETS> pending;
+
+    std::mutex completed_lock;
+    std::vector<WorkItemPtr> completed;
+  };
+
+  void WorkerThreadEntryPoint(void* param, size_t worker_index);
+  void WorkerThreadRun(size_t worker_index);
+  std::optional<PendingWorkItem> TakeWorkItem(size_t worker_index);
 
   Common::Flag m_exit_flag;
   Common::Event m_init_event;
@@ -74,15 +109,25 @@ private:
   std::vector<std::thread> m_worker_threads;
   std::atomic_bool m_worker_thread_start_result{false};
 
-  // A multimap is used to store the work items. We can't use a priority_queue here, because
-  // there's no way to obtain a non-const reference, which we need for the unique_ptr.
-  std::multimap<u32, WorkItemPtr> m_pending_work;
-  std::mutex m_pending_work_lock;
-  std::condition_variable m_worker_thread_wake;
+  // Queues are only created or destroyed while no worker threads are running. Items left in them
+  // when the workers stop are handed to the next set of workers.
+  std::vector<std::unique_ptr<WorkerQueue>> m_worker_queues;
+  std::atomic_size_t m_next_worker_queue{0};
+  std::array<std::atomic_size_t, NUM_PRIORITY_BUCKETS> m_bucket_sizes{};
+  std::atomic_size_t m_queued_items{0};
   std::atomic_size_t m_busy_workers{0};
 
-  std::deque<WorkItemPtr> m_completed_work;
-  std::mutex m_completed_work_lock;
+  std::mutex m_worker_wake_lock;
+  std::condition_variable m_worker_thread_wake;
+  std::atomic_size_t m_sleeping_workers{0};
+
+  // Only accessed by the thread that owns the compiler, for items compiled without workers.
+  std::vector<WorkItemPtr> m_completed_work;
+  std::atomic_size_t m_completed_items{0};
+
+  std::atomic<u64> m_num_items_started{0};
+  std::atomic<DT::rep> m_total_queue_wait{0};
+  std::atomic<DT::rep> m_max_queue_wait{0};
 };
 
 }  // namespace VideoCommon
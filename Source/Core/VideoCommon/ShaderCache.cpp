@@ -104,6 +104,11 @@ void ShaderCache::RetrieveAsyncShaders()
   m_async_shader_compiler->RetrieveWorkItems();
 }
 
+AsyncShaderCompiler::QueueStatistics ShaderCache::GetAsyncCompilerStatistics() const
+{
+  return m_async_shader_compiler->GetQueueStatistics();
+}
+
 void ShaderCache::Shutdown()
 {
   // This may leave shaders uncommitted to the cache, but it's better than blocking shutdown
@@ -739,20 +744,31 @@ std::optional<AbstractPipelineConfig>
 ShaderCache::GetGXPipelineConfig(const GXPipelineUid& config_in)
 {
   GXPipelineUid config = ApplyDriverBugs(config_in);
-  const AbstractShader* vs;
+  PixelShaderUid ps_uid = config.ps_uid;
+  ClearUnusedPixelShaderUidBits(m_api_type, m_host_config, &ps_uid);
+
   auto vs_iter = m_vs_cache.shader_map.find(config.vs_uid);
-  if (vs_iter != m_vs_cache.shader_map.end() && !vs_iter->second.pending)
+  const bool vs_cached = vs_iter != m_vs_cache.shader_map.end() && !vs_iter->second.pending;
+  auto ps_iter = m_ps_cache.shader_map.find(ps_uid);
+  const bool ps_cached = ps_iter != m_ps_cache.shader_map.end() && !ps_iter->second.pending;
+
+  // When both stages are missing, the pixel shader is generated and compiled on a compiler worker
+  // while this thread builds the vertex shader.
+  std::shared_ptr<WorkerShaderCompile> ps_compile;
+  if (!vs_cached && !ps_cached && m_async_shader_compiler->HasWorkerThreads())
+    ps_compile = CompileShaderOnWorker([this, ps_uid] { return CompilePixelShader(ps_uid); });
+
+  const AbstractShader* vs;
+  if (vs_cached)
     vs = vs_iter->second.shader.get();
   else
     vs = InsertVertexShader(config.vs_uid, CompileVertexShader(config.vs_uid));
 
-  PixelShaderUid ps_uid = config.ps_uid;
-  ClearUnusedPixelShaderUidBits(m_api_type, m_host_config, &ps_uid);
-
   const AbstractShader* ps;
-  auto ps_iter = m_ps_cache.shader_map.find(ps_uid);
-  if (ps_iter != m_ps_cache.shader_map.end() && !ps_iter->second.pending)
+  if (ps_cached)
     ps = ps_iter->second.shader.get();
+  else if (ps_compile)
+    ps = InsertPixelShader(ps_uid, FinishShaderCompile(*ps_compile));
   else
     ps = InsertPixelShader(ps_uid, CompilePixelShader(ps_uid));
 
@@ -829,20 +845,29 @@ std::optional<AbstractPipelineConfig>
 ShaderCache::GetGXPipelineConfig(const GXUberPipelineUid& config_in)
 {
   GXUberPipelineUid config = ApplyDriverBugs(config_in);
-  const AbstractShader* vs;
+  UberShader::PixelShaderUid ps_uid = config.ps_uid;
+  UberShader::ClearUnusedPixelShaderUidBits(m_api_type, m_host_config, &ps_uid);
+
   auto vs_iter = m_uber_vs_cache.shader_map.find(config.vs_uid);
-  if (vs_iter != m_uber_vs_cache.shader_map.end() && !vs_iter->second.pending)
+  const bool vs_cached = vs_iter != m_uber_vs_cache.shader_map.end() && !vs_iter->second.pending;
+  auto ps_iter = m_uber_ps_cache.shader_map.find(ps_uid);
+  const bool ps_cached = ps_iter != m_uber_ps_cache.shader_map.end() && !ps_iter->second.pending;
+
+  std::shared_ptr<WorkerShaderCompile> ps_compile;
+  if (!vs_cached && !ps_cached && m_async_shader_compiler->HasWorkerThreads())
+    ps_compile = CompileShaderOnWorker([this, ps_uid] { return CompilePixelUberShader(ps_uid); });
+
+  const AbstractShader* vs;
+  if (vs_cached)
     vs = vs_iter->second.shader.get();
   else
     vs = InsertVertexUberShader(config.vs_uid, CompileVertexUberShader(config.vs_uid));
 
-  UberShader::PixelShaderUid ps_uid = config.ps_uid;
-  UberShader::ClearUnusedPixelShaderUidBits(m_api_type, m_host_config, &ps_uid);
-
   const AbstractShader* ps;
-  auto ps_iter = m_uber_ps_cache.shader_map.find(ps_uid);
-  if (ps_iter != m_uber_ps_cache.shader_map.end() && !ps_iter->second.pending)
+  if (ps_cached)
     ps = ps_iter->second.shader.get();
+  else if (ps_compile)
+    ps = InsertPixelUberShader(ps_uid, FinishShaderCompile(*ps_compile));
   else
     ps = InsertPixelUberShader(ps_uid, CompilePixelUberShader(ps_uid));
 
@@ -1024,6 +1049,48 @@ void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
   }
 }
 
+std::shared_ptr<ShaderCache::WorkerShaderCompile>
+ShaderCache::CompileShaderOnWorker(std::function<std::unique_ptr<AbstractShader>()> compile)
+{
+  class ShaderWorkItem final : public AsyncShaderCompiler::WorkItem
+  {
+  public:
+    explicit ShaderWorkItem(std::shared_ptr<WorkerShaderCompile> compile_)
+        : compile(std::move(compile_))
+    {
+    }
+
+    bool Compile() override
+    {
+      if (!compile->started.test_and_set())
+        compile->task();
+      return true;
+    }
+
+    // The result is handed over through the task's future, not on retrieval.
+    void Retrieve() override {}
+
+  private:
+    std::shared_ptr<WorkerShaderCompile> compile;
+  };
+
+  auto shader_compile = std::make_shared<WorkerShaderCompile>();
+  shader_compile->task = std::packaged_task<std::unique_ptr<AbstractShader>()>(std::move(compile));
+  shader_compile->result = shader_compile->task.get_future();
+  auto wi = m_async_shader_compiler->CreateWorkItem<ShaderWorkItem>(shader_compile);
+  m_async_shader_compiler->QueueWorkItem(std::move(wi), 0);
+  return shader_compile;
+}
+
+std::unique_ptr<AbstractShader> ShaderCache::FinishShaderCompile(WorkerShaderCompile& compile)
+{
+  // If no worker has picked up the compile yet, they are all busy with other work, which may take
+  // much longer than compiling the shader here.
+  if (!compile.started.test_and_set())
+    compile.task();
+  return compile.result.get();
+}
+
 void ShaderCache::QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority)
 {
   class VertexShaderWorkItem final : public AsyncShaderCompiler::WorkItem
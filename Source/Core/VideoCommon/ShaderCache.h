@@ -4,8 +4,11 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstring>
+#include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <optional>
@@ -62,6 +65,9 @@ public:
   // Retrieves all pending shaders/pipelines from the async compiler.
   void RetrieveAsyncShaders();
 
+  // Queue wait times of the background shader compiler.
+  AsyncShaderCompiler::QueueStatistics GetAsyncCompilerStatistics() const;
+
   // Accesses ShaderGen shader caches
   const AbstractPipeline* GetPipelineForUid(const GXPipelineUid& uid);
   const AbstractPipeline* GetUberPipelineForUid(const GXUberPipelineUid& uid);
@@ -163,6 +169,18 @@ private:
   void AppendGXPipelineUID(const GXPipelineUid& config);
 
   // ASync Compiler Methods
+  // Compiles a shader on a compiler worker thread, for use by a synchronous caller that has other
+  // work to do until it needs the result. Whichever of the worker and FinishShaderCompile gets to
+  // the compile first runs it.
+  struct WorkerShaderCompile
+  {
+    std::packaged_task<std::unique_ptr<AbstractShader>()> task;
+    std::future<std::unique_ptr<AbstractShader>> result;
+    std::atomic_flag started;
+  };
+  std::shared_ptr<WorkerShaderCompile>
+  CompileShaderOnWorker(std::function<std::unique_ptr<AbstractShader>()> compile);
+  static std::unique_ptr<AbstractShader> FinishShaderCompile(WorkerShaderCompile& compile);
   void QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority);
   void QueueVertexUberShaderCompile(const UberShader::VertexShaderUid& uid, u32 priority);
   void QueuePixelShaderCompile(const PixelShaderUid& uid, u32 priority);
@@ -12,6 +12,50 @@
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 
+namespace
+{
+// Most specialized shaders fit in the initial reservation. Buffers which had to grow for an
+// ubershader keep their capacity while pooled.
+constexpr size_t SHADER_CODE_INITIAL_CAPACITY = 16384;
+constexpr size_t MAX_POOLED_SHADER_CODE_BUFFERS = 4;
+
+struct ShaderCodeBufferPool
+{
+  ~ShaderCodeBufferPool() { destroyed = true; }
+
+  std::vector<std::string> buffers;
+  // ShaderCode objects with static storage can outlive the pool of the thread destroying them.
+  static thread_local bool destroyed;
+};
+
+thread_local bool ShaderCodeBufferPool::destroyed = false;
+thread_local ShaderCodeBufferPool s_shader_code_buffer_pool;
+}  // namespace
+
+ShaderCode::ShaderCode()
+{
+  if (ShaderCodeBufferPool::destroyed || s_shader_code_buffer_pool.buffers.empty())
+  {
+    m_buffer.reserve(SHADER_CODE_INITIAL_CAPACITY);
+    return;
+  }
+
+  m_buffer = std::move(s_shader_code_buffer_pool.buffers.back());
+  s_shader_code_buffer_pool.buffers.pop_back();
+  m_buffer.clear();
+}
+
+ShaderCode::~ShaderCode()
+{
+  // Moved-from and copied objects may not own a buffer worth keeping.
+  if (ShaderCodeBufferPool::destroyed || m_buffer.capacity() < SHADER_CODE_INITIAL_CAPACITY)
+    return;
+
+  auto& buffers = s_shader_code_buffer_pool.buffers;
+  if (buffers.size() < MAX_POOLED_SHADER_CODE_BUFFERS)
+    buffers.push_back(std::move(m_buffer));
+}
+
 ShaderHostConfig ShaderHostConfig::GetCurrent()
 {
   ShaderHostConfig bits = {};
@@ -105,7 +105,16 @@ private:
 class ShaderCode : public ShaderGeneratorInterface
 {
 public:
-  ShaderCode() { m_buffer.reserve(16384); }
+  // The buffer is taken from a small per-thread pool and handed back on destruction, so that
+  // generating a shader reuses the allocation of a previous one instead of growing a new string.
+  ShaderCode();
+  ShaderCode(const ShaderCode&) = default;
+  ShaderCode(ShaderCode&&) noexcept = default;
+  ~ShaderCode();
+
+  ShaderCode& operator=(const ShaderCode&) = default;
+  ShaderCode& operator=(ShaderCode&&) noexcept = default;
+
   const std::string& GetBuffer() const { return m_buffer; }
 
   // Writes format strings using fmtlib format strings.
@@ -3,6 +3,8 @@
 
 #include "VideoCommon/Statistics.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <utility>
 
@@ -13,6 +15,8 @@
 #include "Core/System.h"
 
 #include "VideoCommon/BPFunctions.h"
+#include "VideoCommon/ShaderCache.h"
+#include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/VideoEvents.h"
@@ -109,7 +113,23 @@ void Statistics::Display() const
   draw_statistic("Vertex streamed", "%i kB", this_frame.bytes_vertex_streamed / 1024);
   draw_statistic("Index streamed", "%i kB", this_frame.bytes_index_streamed / 1024);
   draw_statistic("Uniform streamed", "%i kB", this_frame.bytes_uniform_streamed / 1024);
+  draw_statistic("Texture hashes", "%d", this_frame.num_texture_hashes);
+  draw_statistic("Texture hashed", "%i kB", this_frame.bytes_texture_hashed / 1024);
+  if (g_shader_cache)
+  {
+    const auto queue_stats = g_shader_cache->GetAsyncCompilerStatistics();
+    const double avg_wait_ms =
+        queue_stats.num_items ?
+            std::chrono::duration<double, std::milli>(queue_stats.total_wait).count() /
+                queue_stats.num_items :
+            0.0;
+    draw_statistic("Async shader compiles", "%llu",
+                   static_cast<unsigned long long>(queue_stats.num_items));
+    draw_statistic("Compile queue wait", "%.2f ms avg, %.2f ms max", avg_wait_ms,
+                   std::chrono::duration<double, std::milli>(queue_stats.max_wait).count());
+  }
   draw_statistic("Vertex Loaders", "%d", num_vertex_loaders);
+  draw_statistic("Vertex Loaders (cached)", "%d", num_vertex_loaders_precompiled);
   draw_statistic("EFB peeks:", "%d", this_frame.num_efb_peeks);
   draw_statistic("EFB pokes:", "%d", this_frame.num_efb_pokes);
   draw_statistic("Draw dones:", "%d", this_frame.num_draw_done);
@@ -117,9 +137,40 @@ void Statistics::Display() const
 
   ImGui::Columns(1);
 
+  DisplayVertexLoaders();
+
   ImGui::End();
 }
 
+void Statistics::DisplayVertexLoaders() const
+{
+  if (!ImGui::CollapsingHeader("Vertex Loaders"))
+    return;
+
+  auto loaders = VertexLoaderManager::GetLoaderStatistics();
+  std::ranges::sort(loaders, std::ranges::greater{},
+                    &VertexLoaderManager::LoaderStatistics::load_time);
+
+  ImGui::Columns(3, "VertexLoaders", true);
+  ImGui::TextUnformatted("VCD / VAT");
+  ImGui::NextColumn();
+  ImGui::TextUnformatted("Vertices");
+  ImGui::NextColumn();
+  ImGui::TextUnformatted("Time (ms)");
+  ImGui::NextColumn();
+  for (const auto& loader : loaders)
+  {
+    const auto& data = loader.uid.GetData();
+    ImGui::Text("%08x %08x / %08x %08x %08x", data[0], data[1], data[2], data[3], data[4]);
+    ImGui::NextColumn();
+    ImGui::Text("%llu", static_cast<unsigned long long>(loader.num_vertices));
+    ImGui::NextColumn();
+    ImGui::Text("%.3f", std::chrono::duration<double, std::milli>(loader.load_time).count());
+    ImGui::NextColumn();
+  }
+  ImGui::Columns(1);
+}
+
 void Statistics::DisplayProj() const
 {
   if (!ImGui::Begin("Projection Statistics", nullptr, ImGuiWindowFlags_NoNavInputs))
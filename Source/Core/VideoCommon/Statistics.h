@@ -20,6 +20,7 @@ struct Statistics
   int num_textures_alive = 0;
 
   int num_vertex_loaders = 0;
+  int num_vertex_loaders_precompiled = 0;
 
   std::array<float, 6> proj{};
   std::array<float, 16> gproj{};
@@ -73,6 +74,9 @@ struct Statistics
     int tev_pixels_in = 0;
     int tev_pixels_out = 0;
 
+    int num_texture_hashes = 0;
+    int bytes_texture_hashed = 0;
+
     int num_efb_peeks = 0;
     int num_efb_pokes = 0;
 
@@ -85,6 +89,7 @@ struct Statistics
   void SwapDL();
   void AddScissorRect();
   void Display() const;
+  void DisplayVertexLoaders() const;
   void DisplayProj() const;
   void DisplayScissor();
 };
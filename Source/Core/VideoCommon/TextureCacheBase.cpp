@@ -66,6 +66,16 @@ static int xfb_count = 0;
 
 std::unique_ptr<TextureCacheBase> g_texture_cache;
 
+// All texture memory hashing goes through here so that the statistics show how much guest memory
+// is read for hash verification each frame.
+static u64 HashTextureMemory(const u8* src, u32 len, u32 samples)
+{
+  INCSTAT(g_stats.this_frame.num_texture_hashes);
+  ADDSTAT(g_stats.this_frame.bytes_texture_hashed,
+          samples == 0 ? len : std::min<u64>(len, u64{samples} * sizeof(u64)));
+  return Common::GetHash64(src, len, samples);
+}
+
 TCacheEntry::TCacheEntry(std::unique_ptr<AbstractTexture> tex,
                          std::unique_ptr<AbstractFramebuffer> fb)
     : texture(std::move(tex)), framebuffer(std::move(fb))
@@ -1347,14 +1357,14 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
 
   // TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data
   // from the low tmem bank than it should)
-  base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
+  base_hash = HashTextureMemory(texture_info.GetData(), texture_info.GetTextureSize(),
                                 textureCacheSafetyColorSampleSize);
   u32 palette_size = 0;
   if (texture_info.GetPaletteSize())
   {
     palette_size = *texture_info.GetPaletteSize();
     full_hash =
-        base_hash ^ Common::GetHash64(texture_info.GetTlutAddress(), *texture_info.GetPaletteSize(),
+        base_hash ^ HashTextureMemory(texture_info.GetTlutAddress(), *texture_info.GetPaletteSize(),
                                       textureCacheSafetyColorSampleSize);
   }
   else
@@ -3156,7 +3166,7 @@ u64 TCacheEntry::CalculateHash() const
   u8* ptr = memory.GetPointerForRange(addr, size_in_bytes);
   if (memory_stride == bytes_per_row)
   {
-    return Common::GetHash64(ptr, size_in_bytes, hash_sample_size);
+    return HashTextureMemory(ptr, size_in_bytes, hash_sample_size);
   }
   else
   {
@@ -3175,7 +3185,7 @@ u64 TCacheEntry::CalculateHash() const
     {
       // Multiply by a prime number to mix the hash up a bit. This prevents identical blocks from
       // canceling each other out
-      temp_hash = (temp_hash * 397) ^ Common::GetHash64(ptr, bytes_per_row, samples_per_row);
+      temp_hash = (temp_hash * 397) ^ HashTextureMemory(ptr, bytes_per_row, samples_per_row);
       ptr += memory_stride;
     }
     return temp_hash;
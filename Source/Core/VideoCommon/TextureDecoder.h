@@ -206,3 +206,6 @@ void TexDecoder_SetTexFmtOverlayOptions(bool enable, bool center);
 /* Internal method, implemented by TextureDecoder_Generic and TextureDecoder_x64. */
 void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
                             const u8* tlut, TLUTFormat tlutfmt);
+/* Portable reference decoder from TextureDecoder_Generic, built on every architecture. */
+void _TexDecoder_DecodeImplGeneric(u32* dst, const u8* src, int width, int height,
+                                   TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt);
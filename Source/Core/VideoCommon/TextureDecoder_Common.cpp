@@ -5,12 +5,17 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <latch>
+#include <memory>
 #include <span>
+#include <thread>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
 #include "Common/SpanUtils.h"
 #include "Common/Swap.h"
+#include "Common/WorkQueueThread.h"
 
 #include "VideoCommon/LookUpTables.h"
 #include "VideoCommon/TextureDecoder.h"
@@ -298,10 +303,71 @@ static void TexDecoder_DrawOverlay(u8* dst, int width, int height, TextureFormat
   }
 }
 
+// Textures with at least this many texels are split into bands of block rows which are decoded
+// concurrently. Smaller textures decode faster than the hand-off to the worker threads takes.
+constexpr int PARALLEL_DECODE_MIN_TEXELS = 256 * 256;
+constexpr u32 MAX_DECODE_WORKERS = 3;
+
+static std::vector<std::unique_ptr<Common::AsyncWorkThread>>& GetDecodeWorkers()
+{
+  static std::vector<std::unique_ptr<Common::AsyncWorkThread>> workers = [] {
+    // The calling thread decodes a band itself, so leave a core for it.
+    const u32 num_cores = std::max(std::thread::hardware_concurrency(), 1u);
+    const u32 num_workers = std::min(num_cores - 1, MAX_DECODE_WORKERS);
+
+    std::vector<std::unique_ptr<Common::AsyncWorkThread>> result;
+    for (u32 i = 0; i < num_workers; ++i)
+      result.push_back(std::make_unique<Common::AsyncWorkThread>("Texture Decoder"));
+    return result;
+  }();
+  return workers;
+}
+
+static void DecodeInBands(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
+                          const u8* tlut, TLUTFormat tlutfmt,
+                          std::vector<std::unique_ptr<Common::AsyncWorkThread>>& workers)
+{
+  // Bands always start at a block row, so every band is laid out like a complete texture of the
+  // same width and can be handed to the regular decoder.
+  const int block_width = TexDecoder_GetBlockWidthInTexels(texformat);
+  const int block_height = TexDecoder_GetBlockHeightInTexels(texformat);
+  const int aligned_width = (width + block_width - 1) / block_width * block_width;
+  const int num_block_rows = (height + block_height - 1) / block_height;
+  const int num_bands = std::min(static_cast<int>(workers.size()) + 1, num_block_rows);
+
+  const auto decode_band = [=](int band) {
+    const int y_begin = num_block_rows * band / num_bands * block_height;
+    const int y_end = std::min(num_block_rows * (band + 1) / num_bands * block_height, height);
+    const int src_offset = TexDecoder_GetTextureSizeInBytes(aligned_width, y_begin, texformat);
+    _TexDecoder_DecodeImpl(dst + y_begin * width, src + src_offset, width, y_end - y_begin,
+                           texformat, tlut, tlutfmt);
+  };
+
+  std::latch bands_pending(num_bands - 1);
+  for (int band = 1; band < num_bands; ++band)
+  {
+    workers[band - 1]->Push([&decode_band, &bands_pending, band] {
+      decode_band(band);
+      bands_pending.count_down();
+    });
+  }
+  decode_band(0);
+  bands_pending.wait();
+}
+
 void TexDecoder_Decode(u8* dst, const u8* src, int width, int height, TextureFormat texformat,
                        const u8* tlut, TLUTFormat tlutfmt)
 {
-  _TexDecoder_DecodeImpl((u32*)dst, src, width, height, texformat, tlut, tlutfmt);
+  auto& workers = GetDecodeWorkers();
+  if (width * height < PARALLEL_DECODE_MIN_TEXELS || workers.empty() ||
+      texformat == TextureFormat::XFB)
+  {
+    _TexDecoder_DecodeImpl((u32*)dst, src, width, height, texformat, tlut, tlutfmt);
+  }
+  else
+  {
+    DecodeInBands((u32*)dst, src, width, height, texformat, tlut, tlutfmt, workers);
+  }
 
   if (TexFmt_Overlay_Enable)
     TexDecoder_DrawOverlay(dst, width, height, texformat);
@@ -4,6 +4,7 @@
 #include "VideoCommon/TextureDecoder.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstring>
 
@@ -1157,6 +1158,164 @@ static void TexDecoder_DecodeImpl_RGBA8(u32* dst, const u8* src, int width, int
   }
 }
 
+// Computes the 4-color palettes of two consecutive DXT blocks. Each palette holds the colors in
+// selector order, so that a 2-bit selector can index it directly.
+static inline void DecodeDXTBlockPairPalettes(const __m128i dxt, __m128i* out_colors0,
+                                              __m128i* out_colors1)
+{
+  // JSD NOTE: You may see many strange patterns of behavior in the below code, but they
+  // are for performance reasons. Sometimes, calculating what should be obvious hard-coded
+  // constants is faster than loading their values from memory. Unfortunately, there is no
+  // way to inline 128-bit constants from opcodes so they must be loaded from memory. This
+  // seems a little ridiculous to me in that you can't even generate a constant value of 1
+  // without having to load it from memory. So, I stored the minimal constant I could,
+  // 128-bits worth of 1s :). Then I use sequences of shifts to squash it to the appropriate
+  // size and bitpositions that I need.
+  const __m128i allFFs128 = _mm_cmpeq_epi32(_mm_setzero_si128(), _mm_setzero_si128());
+
+  __m128i argb888x4;
+  __m128i c1 = _mm_unpackhi_epi16(dxt, dxt);
+  c1 = _mm_slli_si128(c1, 8);
+  const __m128i c0 =
+      _mm_or_si128(c1, _mm_srli_si128(_mm_slli_si128(_mm_unpacklo_epi16(dxt, dxt), 8), 8));
+
+  // Compare rgb0 to rgb1:
+  // Each 32-bit word will contain either 0xFFFFFFFF or 0x00000000 for true/false.
+  const __m128i c0cmp = _mm_srli_epi32(_mm_slli_epi32(_mm_srli_epi64(c0, 8), 16), 16);
+  const __m128i c0shr = _mm_srli_epi64(c0cmp, 32);
+  const __m128i cmprgb0rgb1 = _mm_cmpgt_epi32(c0cmp, c0shr);
+
+  int cmp0 = _mm_extract_epi16(cmprgb0rgb1, 0);
+  int cmp1 = _mm_extract_epi16(cmprgb0rgb1, 4);
+
+  // green:
+  // NOTE: We start with the larger number of bits (6) firts for G and shift the mask down
+  // 1 bit to get a 5-bit mask later for R and B components.
+  // low6mask == _mm_set_epi32(0x0000FC00, 0x0000FC00, 0x0000FC00, 0x0000FC00)
+  const __m128i low6mask = _mm_slli_epi32(_mm_srli_epi32(allFFs128, 24 + 2), 8 + 2);
+  const __m128i gtmp = _mm_srli_epi32(c0, 3);
+  const __m128i g0 = _mm_and_si128(gtmp, low6mask);
+  // low3mask == _mm_set_epi32(0x00000300, 0x00000300, 0x00000300, 0x00000300)
+  const __m128i g1 = _mm_and_si128(
+      _mm_srli_epi32(gtmp, 6), _mm_set_epi32(0x00000300, 0x00000300, 0x00000300, 0x00000300));
+  argb888x4 = _mm_or_si128(g0, g1);
+  // red:
+  // low5mask == _mm_set_epi32(0x000000F8, 0x000000F8, 0x000000F8, 0x000000F8)
+  const __m128i low5mask = _mm_slli_epi32(_mm_srli_epi32(low6mask, 8 + 3), 3);
+  const __m128i r0 = _mm_and_si128(c0, low5mask);
+  const __m128i r1 = _mm_srli_epi32(r0, 5);
+  argb888x4 = _mm_or_si128(argb888x4, _mm_or_si128(r0, r1));
+  // blue:
+  // _mm_slli_epi32(low5mask, 16) == _mm_set_epi32(0x00F80000, 0x00F80000, 0x00F80000,
+  // 0x00F80000)
+  const __m128i b0 = _mm_and_si128(_mm_srli_epi32(c0, 5), _mm_slli_epi32(low5mask, 16));
+  const __m128i b1 = _mm_srli_epi16(b0, 5);
+  // OR in the fixed alpha component
+  // _mm_slli_epi32( allFFs128, 24 ) == _mm_set_epi32(0xFF000000, 0xFF000000, 0xFF000000,
+  // 0xFF000000)
+  argb888x4 = _mm_or_si128(_mm_or_si128(argb888x4, _mm_slli_epi32(allFFs128, 24)),
+                           _mm_or_si128(b0, b1));
+  // calculate RGB2 and RGB3:
+  const __m128i rgb0 = _mm_shuffle_epi32(argb888x4, _MM_SHUFFLE(2, 2, 0, 0));
+  const __m128i rgb1 = _mm_shuffle_epi32(argb888x4, _MM_SHUFFLE(3, 3, 1, 1));
+  const __m128i rrggbb0 =
+      _mm_and_si128(_mm_unpacklo_epi8(rgb0, rgb0), _mm_srli_epi16(allFFs128, 8));
+  const __m128i rrggbb1 =
+      _mm_and_si128(_mm_unpacklo_epi8(rgb1, rgb1), _mm_srli_epi16(allFFs128, 8));
+  const __m128i rrggbb01 =
+      _mm_and_si128(_mm_unpackhi_epi8(rgb0, rgb0), _mm_srli_epi16(allFFs128, 8));
+  const __m128i rrggbb11 =
+      _mm_and_si128(_mm_unpackhi_epi8(rgb1, rgb1), _mm_srli_epi16(allFFs128, 8));
+
+  __m128i rgb2, rgb3;
+
+  // if (rgb0 > rgb1):
+  if (cmp0 != 0)
+  {
+    // RGB2 = (RGB0 * 5 + RGB1 * 3) / 8 = (RGB0 << 2 + RGB1 << 1 + (RGB0 + RGB1)) >> 3
+    // RGB3 = (RGB0 * 3 + RGB1 * 5) / 8 = (RGB0 << 1 + RGB1 << 2 + (RGB0 + RGB1)) >> 3
+    const __m128i rrggbbsum = _mm_add_epi16(rrggbb0, rrggbb1);
+
+    const __m128i rrggbb0shl1 = _mm_slli_epi16(rrggbb0, 1);
+    const __m128i rrggbb0shl2 = _mm_slli_epi16(rrggbb0, 2);
+
+    const __m128i rrggbb1shl1 = _mm_slli_epi16(rrggbb1, 1);
+    const __m128i rrggbb1shl2 = _mm_slli_epi16(rrggbb1, 2);
+
+    const __m128i rrggbb2 =
+        _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(rrggbb0shl2, rrggbb1shl1), rrggbbsum), 3);
+    const __m128i rrggbb3 =
+        _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(rrggbb0shl1, rrggbb1shl2), rrggbbsum), 3);
+
+    const __m128i rgb2dup = _mm_packus_epi16(rrggbb2, rrggbb2);
+    const __m128i rgb3dup = _mm_packus_epi16(rrggbb3, rrggbb3);
+
+    rgb2 = _mm_and_si128(rgb2dup, _mm_srli_si128(allFFs128, 8));
+    rgb3 = _mm_and_si128(rgb3dup, _mm_srli_si128(allFFs128, 8));
+  }
+  else
+  {
+    // RGB2b = avg(RGB0, RGB1)
+    const __m128i rrggbb21 = _mm_srai_epi16(_mm_add_epi16(rrggbb0, rrggbb1), 1);
+    const __m128i rgb210 = _mm_srli_si128(_mm_packus_epi16(rrggbb21, rrggbb21), 8);
+    rgb2 = rgb210;
+    rgb3 = _mm_and_si128(rgb210, _mm_srli_epi32(allFFs128, 8));
+  }
+
+  // if (rgb0 > rgb1):
+  if (cmp1 != 0)
+  {
+    // RGB2 = (RGB0 * 5 + RGB1 * 3) / 8 = (RGB0 << 2 + RGB1 << 1 + (RGB0 + RGB1)) >> 3
+    // RGB3 = (RGB0 * 3 + RGB1 * 5) / 8 = (RGB0 << 1 + RGB1 << 2 + (RGB0 + RGB1)) >> 3
+    const __m128i rrggbbsum = _mm_add_epi16(rrggbb01, rrggbb11);
+
+    const __m128i rrggbb0shl1 = _mm_slli_epi16(rrggbb01, 1);
+    const __m128i rrggbb0shl2 = _mm_slli_epi16(rrggbb01, 2);
+
+    const __m128i rrggbb1shl1 = _mm_slli_epi16(rrggbb11, 1);
+    const __m128i rrggbb1shl2 = _mm_slli_epi16(rrggbb11, 2);
+
+    const __m128i rrggbb2 =
+        _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(rrggbb0shl2, rrggbb1shl1), rrggbbsum), 3);
+    const __m128i rrggbb3 =
+        _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(rrggbb0shl1, rrggbb1shl2), rrggbbsum), 3);
+
+    const __m128i rgb2dup = _mm_packus_epi16(rrggbb2, rrggbb2);
+    const __m128i rgb3dup = _mm_packus_epi16(rrggbb3, rrggbb3);
+
+    rgb2 = _mm_or_si128(rgb2, _mm_and_si128(rgb2dup, _mm_slli_si128(allFFs128, 8)));
+    rgb3 = _mm_or_si128(rgb3, _mm_and_si128(rgb3dup, _mm_slli_si128(allFFs128, 8)));
+  }
+  else
+  {
+    // RGB2b = avg(RGB0, RGB1)
+    const __m128i rrggbb211 = _mm_srai_epi16(_mm_add_epi16(rrggbb01, rrggbb11), 1);
+    const __m128i rgb211 = _mm_slli_si128(_mm_packus_epi16(rrggbb211, rrggbb211), 8);
+    rgb2 = _mm_or_si128(rgb2, rgb211);
+
+    // _mm_srli_epi32( allFFs128, 8 ) == _mm_set_epi32(0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    // 0x00FFFFFF)
+    // Make this color fully transparent:
+    rgb3 = _mm_or_si128(rgb3, _mm_and_si128(_mm_and_si128(rgb2, _mm_srli_epi32(allFFs128, 8)),
+                                            _mm_slli_si128(allFFs128, 8)));
+  }
+
+  // Create an array for color lookups for DXT0 so we can use the 2-bit indices:
+  const __m128i mmcolors0 = _mm_or_si128(
+      _mm_or_si128(_mm_srli_si128(_mm_slli_si128(argb888x4, 8), 8),
+                   _mm_slli_si128(_mm_srli_si128(_mm_slli_si128(rgb2, 8), 8 + 4), 8)),
+      _mm_slli_si128(_mm_srli_si128(rgb3, 4), 8 + 4));
+
+  // Create an array for color lookups for DXT1 so we can use the 2-bit indices:
+  const __m128i mmcolors1 =
+      _mm_or_si128(_mm_or_si128(_mm_srli_si128(argb888x4, 8),
+                                _mm_slli_si128(_mm_srli_si128(rgb2, 8 + 4), 8)),
+                   _mm_slli_si128(_mm_srli_si128(rgb3, 8 + 4), 8 + 4));
+
+  *out_colors0 = mmcolors0;
+  *out_colors1 = mmcolors1;
+}
+
 static void TexDecoder_DecodeImpl_CMPR(u32* dst, const u8* src, int width, int height,
                                        TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt,
                                        int Wsteps4, int Wsteps8)
@@ -1176,16 +1335,6 @@ static void TexDecoder_DecodeImpl_CMPR(u32* dst, const u8* src, int width, int h
       // parallelizable at this level, so we do.
       for (int z = 0, xStep = 2 * yStep; z < 2; ++z, xStep++)
       {
-        // JSD NOTE: You may see many strange patterns of behavior in the below code, but they
-        // are for performance reasons. Sometimes, calculating what should be obvious hard-coded
-        // constants is faster than loading their values from memory. Unfortunately, there is no
-        // way to inline 128-bit constants from opcodes so they must be loaded from memory. This
-        // seems a little ridiculous to me in that you can't even generate a constant value of 1
-        // without having to load it from memory. So, I stored the minimal constant I could,
-        // 128-bits worth of 1s :). Then I use sequences of shifts to squash it to the appropriate
-        // size and bitpositions that I need.
-        const __m128i allFFs128 = _mm_cmpeq_epi32(_mm_setzero_si128(), _mm_setzero_si128());
-
         // Load 128 bits, i.e. two DXTBlocks (64-bits each)
         const __m128i dxt = _mm_loadu_si128((__m128i*)(src + sizeof(struct DXTBlock) * 2 * xStep));
 
@@ -1196,144 +1345,8 @@ static void TexDecoder_DecodeImpl_CMPR(u32* dst, const u8* src, int width, int h
         u32 dxt0sel = dxttmp[1];
         u32 dxt1sel = dxttmp[3];
 
-        __m128i argb888x4;
-        __m128i c1 = _mm_unpackhi_epi16(dxt, dxt);
-        c1 = _mm_slli_si128(c1, 8);
-        const __m128i c0 =
-            _mm_or_si128(c1, _mm_srli_si128(_mm_slli_si128(_mm_unpacklo_epi16(dxt, dxt), 8), 8));
-
-        // Compare rgb0 to rgb1:
-        // Each 32-bit word will contain either 0xFFFFFFFF or 0x00000000 for true/false.
-        const __m128i c0cmp = _mm_srli_epi32(_mm_slli_epi32(_mm_srli_epi64(c0, 8), 16), 16);
-        const __m128i c0shr = _mm_srli_epi64(c0cmp, 32);
-        const __m128i cmprgb0rgb1 = _mm_cmpgt_epi32(c0cmp, c0shr);
-
-        int cmp0 = _mm_extract_epi16(cmprgb0rgb1, 0);
-        int cmp1 = _mm_extract_epi16(cmprgb0rgb1, 4);
-
-        // green:
-        // NOTE: We start with the larger number of bits (6) firts for G and shift the mask down
-        // 1 bit to get a 5-bit mask later for R and B components.
-        // low6mask == _mm_set_epi32(0x0000FC00, 0x0000FC00, 0x0000FC00, 0x0000FC00)
-        const __m128i low6mask = _mm_slli_epi32(_mm_srli_epi32(allFFs128, 24 + 2), 8 + 2);
-        const __m128i gtmp = _mm_srli_epi32(c0, 3);
-        const __m128i g0 = _mm_and_si128(gtmp, low6mask);
-        // low3mask == _mm_set_epi32(0x00000300, 0x00000300, 0x00000300, 0x00000300)
-        const __m128i g1 = _mm_and_si128(
-            _mm_srli_epi32(gtmp, 6), _mm_set_epi32(0x00000300, 0x00000300, 0x00000300, 0x00000300));
-        argb888x4 = _mm_or_si128(g0, g1);
-        // red:
-        // low5mask == _mm_set_epi32(0x000000F8, 0x000000F8, 0x000000F8, 0x000000F8)
-        const __m128i low5mask = _mm_slli_epi32(_mm_srli_epi32(low6mask, 8 + 3), 3);
-        const __m128i r0 = _mm_and_si128(c0, low5mask);
-        const __m128i r1 = _mm_srli_epi32(r0, 5);
-        argb888x4 = _mm_or_si128(argb888x4, _mm_or_si128(r0, r1));
-        // blue:
-        // _mm_slli_epi32(low5mask, 16) == _mm_set_epi32(0x00F80000, 0x00F80000, 0x00F80000,
-        // 0x00F80000)
-        const __m128i b0 = _mm_and_si128(_mm_srli_epi32(c0, 5), _mm_slli_epi32(low5mask, 16));
-        const __m128i b1 = _mm_srli_epi16(b0, 5);
-        // OR in the fixed alpha component
-        // _mm_slli_epi32( allFFs128, 24 ) == _mm_set_epi32(0xFF000000, 0xFF000000, 0xFF000000,
-        // 0xFF000000)
-        argb888x4 = _mm_or_si128(_mm_or_si128(argb888x4, _mm_slli_epi32(allFFs128, 24)),
-                                 _mm_or_si128(b0, b1));
-        // calculate RGB2 and RGB3:
-        const __m128i rgb0 = _mm_shuffle_epi32(argb888x4, _MM_SHUFFLE(2, 2, 0, 0));
-        const __m128i rgb1 = _mm_shuffle_epi32(argb888x4, _MM_SHUFFLE(3, 3, 1, 1));
-        const __m128i rrggbb0 =
-            _mm_and_si128(_mm_unpacklo_epi8(rgb0, rgb0), _mm_srli_epi16(allFFs128, 8));
-        const __m128i rrggbb1 =
-            _mm_and_si128(_mm_unpacklo_epi8(rgb1, rgb1), _mm_srli_epi16(allFFs128, 8));
-        const __m128i rrggbb01 =
-            _mm_and_si128(_mm_unpackhi_epi8(rgb0, rgb0), _mm_srli_epi16(allFFs128, 8));
-        const __m128i rrggbb11 =
-            _mm_and_si128(_mm_unpackhi_epi8(rgb1, rgb1), _mm_srli_epi16(allFFs128, 8));
-
-        __m128i rgb2, rgb3;
-
-        // if (rgb0 > rgb1):
-        if (cmp0 != 0)
-        {
-          // RGB2 = (RGB0 * 5 + RGB1 * 3) / 8 = (RGB0 << 2 + RGB1 << 1 + (RGB0 + RGB1)) >> 3
-          // RGB3 = (RGB0 * 3 + RGB1 * 5) / 8 = (RGB0 << 1 + RGB1 << 2 + (RGB0 + RGB1)) >> 3
-          const __m128i rrggbbsum = _mm_add_epi16(rrggbb0, rrggbb1);
-
-          const __m128i rrggbb0shl1 = _mm_slli_epi16(rrggbb0, 1);
-          const __m128i rrggbb0shl2 = _mm_slli_epi16(rrggbb0, 2);
-
-          const __m128i rrggbb1shl1 = _mm_slli_epi16(rrggbb1, 1);
-          const __m128i rrggbb1shl2 = _mm_slli_epi16(rrggbb1, 2);
-
-          const __m128i rrggbb2 =
-              _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(rrggbb0shl2, rrggbb1shl1), rrggbbsum), 3);
-          const __m128i rrggbb3 =
-              _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(rrggbb0shl1, rrggbb1shl2), rrggbbsum), 3);
-
-          const __m128i rgb2dup = _mm_packus_epi16(rrggbb2, rrggbb2);
-          const __m128i rgb3dup = _mm_packus_epi16(rrggbb3, rrggbb3);
-
-          rgb2 = _mm_and_si128(rgb2dup, _mm_srli_si128(allFFs128, 8));
-          rgb3 = _mm_and_si128(rgb3dup, _mm_srli_si128(allFFs128, 8));
-        }
-        else
-        {
-          // RGB2b = avg(RGB0, RGB1)
-          const __m128i rrggbb21 = _mm_srai_epi16(_mm_add_epi16(rrggbb0, rrggbb1), 1);
-          const __m128i rgb210 = _mm_srli_si128(_mm_packus_epi16(rrggbb21, rrggbb21), 8);
-          rgb2 = rgb210;
-          rgb3 = _mm_and_si128(rgb210, _mm_srli_epi32(allFFs128, 8));
-        }
-
-        // if (rgb0 > rgb1):
-        if (cmp1 != 0)
-        {
-          // RGB2 = (RGB0 * 5 + RGB1 * 3) / 8 = (RGB0 << 2 + RGB1 << 1 + (RGB0 + RGB1)) >> 3
-          // RGB3 = (RGB0 * 3 + RGB1 * 5) / 8 = (RGB0 << 1 + RGB1 << 2 + (RGB0 + RGB1)) >> 3
-          const __m128i rrggbbsum = _mm_add_epi16(rrggbb01, rrggbb11);
-
-          const __m128i rrggbb0shl1 = _mm_slli_epi16(rrggbb01, 1);
-          const __m128i rrggbb0shl2 = _mm_slli_epi16(rrggbb01, 2);
-
-          const __m128i rrggbb1shl1 = _mm_slli_epi16(rrggbb11, 1);
-          const __m128i rrggbb1shl2 = _mm_slli_epi16(rrggbb11, 2);
-
-          const __m128i rrggbb2 =
-              _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(rrggbb0shl2, rrggbb1shl1), rrggbbsum), 3);
-          const __m128i rrggbb3 =
-              _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(rrggbb0shl1, rrggbb1shl2), rrggbbsum), 3);
-
-          const __m128i rgb2dup = _mm_packus_epi16(rrggbb2, rrggbb2);
-          const __m128i rgb3dup = _mm_packus_epi16(rrggbb3, rrggbb3);
-
-          rgb2 = _mm_or_si128(rgb2, _mm_and_si128(rgb2dup, _mm_slli_si128(allFFs128, 8)));
-          rgb3 = _mm_or_si128(rgb3, _mm_and_si128(rgb3dup, _mm_slli_si128(allFFs128, 8)));
-        }
-        else
-        {
-          // RGB2b = avg(RGB0, RGB1)
-          const __m128i rrggbb211 = _mm_srai_epi16(_mm_add_epi16(rrggbb01, rrggbb11), 1);
-          const __m128i rgb211 = _mm_slli_si128(_mm_packus_epi16(rrggbb211, rrggbb211), 8);
-          rgb2 = _mm_or_si128(rgb2, rgb211);
-
-          // _mm_srli_epi32( allFFs128, 8 ) == _mm_set_epi32(0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
-          // 0x00FFFFFF)
-          // Make this color fully transparent:
-          rgb3 = _mm_or_si128(rgb3, _mm_and_si128(_mm_and_si128(rgb2, _mm_srli_epi32(allFFs128, 8)),
-                                                  _mm_slli_si128(allFFs128, 8)));
-        }
-
-        // Create an array for color lookups for DXT0 so we can use the 2-bit indices:
-        const __m128i mmcolors0 = _mm_or_si128(
-            _mm_or_si128(_mm_srli_si128(_mm_slli_si128(argb888x4, 8), 8),
-                         _mm_slli_si128(_mm_srli_si128(_mm_slli_si128(rgb2, 8), 8 + 4), 8)),
-            _mm_slli_si128(_mm_srli_si128(rgb3, 4), 8 + 4));
-
-        // Create an array for color lookups for DXT1 so we can use the 2-bit indices:
-        const __m128i mmcolors1 =
-            _mm_or_si128(_mm_or_si128(_mm_srli_si128(argb888x4, 8),
-                                      _mm_slli_si128(_mm_srli_si128(rgb2, 8 + 4), 8)),
-                         _mm_slli_si128(_mm_srli_si128(rgb3, 8 + 4), 8 + 4));
+        __m128i mmcolors0, mmcolors1;
+        DecodeDXTBlockPairPalettes(dxt, &mmcolors0, &mmcolors1);
 
 // The #ifdef CHECKs here and below are to compare correctness of output against the reference code.
 // Don't use them in a normal build.
@@ -1413,6 +1426,287 @@ static void TexDecoder_DecodeImpl_CMPR(u32* dst, const u8* src, int width, int h
   }
 }
 
+// Decodes the first num_entries TLUT entries to RGBA8, for the AVX2 paletted decoders which look
+// up texels with permutes and gathers instead of decoding every texel's palette entry.
+static bool DecodePalette(u32* palette, const u8* tlut_, TLUTFormat tlutfmt, int num_entries)
+{
+  const u16* tlut = (const u16*)tlut_;
+  switch (tlutfmt)
+  {
+  case TLUTFormat::IA8:
+    for (int i = 0; i < num_entries; i++)
+      palette[i] = DecodePixel_IA8(tlut[i]);
+    return true;
+
+  case TLUTFormat::RGB565:
+    for (int i = 0; i < num_entries; i++)
+      palette[i] = DecodePixel_RGB565(Common::swap16(tlut[i]));
+    return true;
+
+  case TLUTFormat::RGB5A3:
+    for (int i = 0; i < num_entries; i++)
+      palette[i] = DecodePixel_RGB5A3(Common::swap16(tlut[i]));
+    return true;
+
+  default:
+    return false;
+  }
+}
+
+// The paletted AVX2 decoders return false for TLUT formats that DecodePalette doesn't handle, so
+// that the caller can fall back to the generic decoder.
+FUNCTION_TARGET_AVX2
+static bool TexDecoder_DecodeImpl_C4_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  alignas(32) u32 palette[16];
+  if (!DecodePalette(palette, tlut, tlutfmt, 16))
+    return false;
+
+  // The 16 palette entries fit in two registers, so each row of 8 texels is looked up with two
+  // permutes, and bit 3 of the index selects between them.
+  const __m256i palette_lo = _mm256_load_si256((const __m256i*)palette);
+  const __m256i palette_hi = _mm256_load_si256((const __m256i*)(palette + 8));
+  const __m256i nibble_shifts = _mm256_setr_epi32(4, 0, 4, 0, 4, 0, 4, 0);
+  const __m256i kMask_x0f = _mm256_set1_epi32(0x0000000f);
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 8 * yStep; iy < 8; iy++, xStep++)
+      {
+        u32 row;
+        std::memcpy(&row, src + 4 * xStep, sizeof(row));
+        // (0000 dcba) -> (dd cc bb aa) in 32-bit lanes -> (d.lo d.hi ... a.lo a.hi)
+        const __m128i bytes = _mm_cvtsi32_si128(row);
+        const __m256i doubled = _mm256_cvtepu8_epi32(_mm_unpacklo_epi8(bytes, bytes));
+        const __m256i indices =
+            _mm256_and_si256(_mm256_srlv_epi32(doubled, nibble_shifts), kMask_x0f);
+
+        const __m256 lo = _mm256_castsi256_ps(_mm256_permutevar8x32_epi32(palette_lo, indices));
+        const __m256 hi = _mm256_castsi256_ps(_mm256_permutevar8x32_epi32(palette_hi, indices));
+        const __m256 select_hi = _mm256_castsi256_ps(_mm256_slli_epi32(indices, 28));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x),
+                            _mm256_castps_si256(_mm256_blendv_ps(lo, hi, select_hi)));
+      }
+    }
+  }
+
+  return true;
+}
+
+FUNCTION_TARGET_AVX2
+static bool TexDecoder_DecodeImpl_C8_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  alignas(32) u32 palette[256];
+  if (!DecodePalette(palette, tlut, tlutfmt, 256))
+    return false;
+
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m256i indices =
+            _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + 8 * xStep)));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x),
+                            _mm256_i32gather_epi32((const int*)palette, indices, 4));
+      }
+    }
+  }
+
+  return true;
+}
+
+FUNCTION_TARGET_AVX2
+static bool TexDecoder_DecodeImpl_C14X2_AVX2(u32* dst, const u8* src, int width, int height,
+                                             TextureFormat texformat, const u8* tlut,
+                                             TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m128i swap_mask = _mm_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+  const __m128i kMask_x3fff = _mm_set1_epi16(0x3fff);
+
+  // Textures rarely use more than a small part of the 16384-entry palette, so find the highest
+  // index first and only decode the entries up to it. This reads the same whole 4x4 blocks, 32
+  // bytes each, that the loop below decodes.
+  const __m256i swap_mask_256 = _mm256_broadcastsi128_si256(swap_mask);
+  const __m256i kMask_x3fff_256 = _mm256_broadcastsi128_si256(kMask_x3fff);
+  __m256i max_indices = _mm256_setzero_si256();
+  for (int i = 0; i < Wsteps4 * ((height + 3) / 4) * 32; i += 32)
+  {
+    const __m256i raw = _mm256_loadu_si256((const __m256i*)(src + i));
+    max_indices = _mm256_max_epu16(
+        max_indices, _mm256_and_si256(_mm256_shuffle_epi8(raw, swap_mask_256), kMask_x3fff_256));
+  }
+  // The minimum of the inverted indices is the inverted maximum
+  const __m128i max_indices_128 = _mm_max_epu16(_mm256_castsi256_si128(max_indices),
+                                                _mm256_extracti128_si256(max_indices, 1));
+  const int max_index =
+      0xffff ^ _mm_extract_epi16(
+                   _mm_minpos_epu16(_mm_xor_si128(max_indices_128, _mm_set1_epi16(-1))), 0);
+
+  alignas(32) static thread_local std::array<u32, 16384> palette;
+  if (!DecodePalette(palette.data(), tlut, tlutfmt, max_index + 1))
+    return false;
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+    {
+      // Two consecutive rows of a block are adjacent in memory, so decode them together.
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy += 2, xStep += 2)
+      {
+        const __m128i raw = _mm_loadu_si128((const __m128i*)(src + 8 * xStep));
+        const __m128i indices16 = _mm_and_si128(_mm_shuffle_epi8(raw, swap_mask), kMask_x3fff);
+        const __m256i texels = _mm256_i32gather_epi32((const int*)palette.data(),
+                                                      _mm256_cvtepu16_epi32(indices16), 4);
+        u32* newdst = dst + (y + iy) * width + x;
+        _mm_storeu_si128((__m128i*)newdst, _mm256_castsi256_si128(texels));
+        _mm_storeu_si128((__m128i*)(newdst + width), _mm256_extracti128_si256(texels, 1));
+      }
+    }
+  }
+
+  return true;
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_IA8_AVX2(u32* dst, const u8* src, int width, int height,
+                                           TextureFormat texformat, const u8* tlut,
+                                           TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Same shuffle as the SSSE3 version, but for two rows at once: the lower half of the register
+  // expands the first row (bytes 0-7), the upper half the second row (bytes 8-15).
+  const __m256i mask = _mm256_setr_epi8(1, 1, 1, 0, 3, 3, 3, 2, 5, 5, 5, 4, 7, 7, 7, 6,  //
+                                        9, 9, 9, 8, 11, 11, 11, 10, 13, 13, 13, 12, 15, 15, 15, 14);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy += 2, xStep += 2)
+      {
+        const __m256i r0 = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128((const __m128i*)(src + 8 * xStep)));
+        const __m256i r1 = _mm256_shuffle_epi8(r0, mask);
+        u32* newdst = dst + (y + iy) * width + x;
+        _mm_storeu_si128((__m128i*)newdst, _mm256_castsi256_si128(r1));
+        _mm_storeu_si128((__m128i*)(newdst + width), _mm256_extracti128_si256(r1, 1));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGB5A3_AVX2(u32* dst, const u8* src, int width, int height,
+                                              TextureFormat texformat, const u8* tlut,
+                                              TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Byte-swaps the 16-bit texels of two rows into 32-bit lanes, as in the SSSE3 version.
+  const __m256i mask = _mm256_setr_epi8(1, 0, -128, -128, 3, 2, -128, -128,    //
+                                        5, 4, -128, -128, 7, 6, -128, -128,    //
+                                        9, 8, -128, -128, 11, 10, -128, -128,  //
+                                        13, 12, -128, -128, 15, 14, -128, -128);
+  const __m256i kMask_x1f = _mm256_set1_epi32(0x0000001f);
+  const __m256i kMask_x0f = _mm256_set1_epi32(0x0000000f);
+  const __m256i kMask_x07 = _mm256_set1_epi32(0x00000007);
+  const __m256i kAlpha = _mm256_set1_epi32(0xFF000000);
+
+  // Unlike the SSSE3 version, both the RGB555 and the RGB4443 results are always computed, and
+  // bit 15 of each texel selects between them. That avoids the scalar fallback for mixed rows.
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy += 2, xStep += 2)
+      {
+        const __m256i valV = _mm256_shuffle_epi8(
+            _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(src + 8 * xStep))),
+            mask);
+
+        // RGB555: Swizzle bits: 00012345 -> 12345123
+        const __m256i r5 = _mm256_and_si256(_mm256_srli_epi32(valV, 10), kMask_x1f);
+        const __m256i g5 = _mm256_and_si256(_mm256_srli_epi32(valV, 5), kMask_x1f);
+        const __m256i b5 = _mm256_and_si256(valV, kMask_x1f);
+        const __m256i r555 = _mm256_or_si256(_mm256_slli_epi32(r5, 3), _mm256_srli_epi32(r5, 2));
+        const __m256i g555 = _mm256_or_si256(_mm256_slli_epi32(g5, 3), _mm256_srli_epi32(g5, 2));
+        const __m256i b555 = _mm256_or_si256(_mm256_slli_epi32(b5, 3), _mm256_srli_epi32(b5, 2));
+        const __m256i rgb555 =
+            _mm256_or_si256(_mm256_or_si256(r555, _mm256_slli_epi32(g555, 8)),
+                            _mm256_or_si256(_mm256_slli_epi32(b555, 16), kAlpha));
+
+        // RGBA4443: Swizzle bits: 00001234 -> 12341234, alpha 00000123 -> 12312312
+        const __m256i r4 = _mm256_and_si256(_mm256_srli_epi32(valV, 8), kMask_x0f);
+        const __m256i g4 = _mm256_and_si256(_mm256_srli_epi32(valV, 4), kMask_x0f);
+        const __m256i b4 = _mm256_and_si256(valV, kMask_x0f);
+        const __m256i a3 = _mm256_and_si256(_mm256_srli_epi32(valV, 12), kMask_x07);
+        const __m256i r4443 = _mm256_or_si256(_mm256_slli_epi32(r4, 4), r4);
+        const __m256i g4443 = _mm256_or_si256(_mm256_slli_epi32(g4, 4), g4);
+        const __m256i b4443 = _mm256_or_si256(_mm256_slli_epi32(b4, 4), b4);
+        const __m256i a4443 =
+            _mm256_or_si256(_mm256_slli_epi32(a3, 5),
+                            _mm256_or_si256(_mm256_slli_epi32(a3, 2), _mm256_srli_epi32(a3, 1)));
+        const __m256i rgba4443 =
+            _mm256_or_si256(_mm256_or_si256(r4443, _mm256_slli_epi32(g4443, 8)),
+                            _mm256_or_si256(_mm256_slli_epi32(b4443, 16),
+                                            _mm256_slli_epi32(a4443, 24)));
+
+        const __m256 is_rgb555 = _mm256_castsi256_ps(_mm256_slli_epi32(valV, 16));
+        const __m256i final = _mm256_castps_si256(_mm256_blendv_ps(
+            _mm256_castsi256_ps(rgba4443), _mm256_castsi256_ps(rgb555), is_rgb555));
+
+        u32* newdst = dst + (y + iy) * width + x;
+        _mm_storeu_si128((__m128i*)newdst, _mm256_castsi256_si128(final));
+        _mm_storeu_si128((__m128i*)(newdst + width), _mm256_extracti128_si256(final, 1));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_CMPR_AVX2(u32* dst, const u8* src, int width, int height,
+                                            TextureFormat texformat, const u8* tlut,
+                                            TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // The palettes of both DXT blocks of a pair are placed in one register, the left block's in
+  // lanes 0-3 and the right block's in lanes 4-7. A whole 8-texel row of the pair is then a single
+  // permute, instead of eight scalar table lookups.
+  const __m256i selector_shifts = _mm256_setr_epi32(6, 4, 2, 0, 6, 4, 2, 0);
+  const __m256i lane_offsets = _mm256_setr_epi32(0, 0, 0, 0, 4, 4, 4, 4);
+  const __m256i selector_words = _mm256_setr_epi32(1, 1, 1, 1, 3, 3, 3, 3);
+  const __m256i kMask_x03 = _mm256_set1_epi32(0x00000003);
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int z = 0, xStep = 2 * yStep; z < 2; ++z, xStep++)
+      {
+        const __m128i dxt = _mm_loadu_si128((__m128i*)(src + sizeof(struct DXTBlock) * 2 * xStep));
+
+        __m128i mmcolors0, mmcolors1;
+        DecodeDXTBlockPairPalettes(dxt, &mmcolors0, &mmcolors1);
+        const __m256i colors = _mm256_set_m128i(mmcolors1, mmcolors0);
+
+        // Broadcast the selector word of each block to the lanes of its half.
+        const __m256i selectors =
+            _mm256_permutevar8x32_epi32(_mm256_castsi128_si256(dxt), selector_words);
+
+        u32* dst32 = dst + (y + z * 4) * width + x;
+        for (int row = 0; row < 4; row++)
+        {
+          const __m256i shifts = _mm256_add_epi32(selector_shifts, _mm256_set1_epi32(row * 8));
+          const __m256i indices = _mm256_add_epi32(
+              _mm256_and_si256(_mm256_srlv_epi32(selectors, shifts), kMask_x03), lane_offsets);
+          _mm256_storeu_si256((__m256i*)(dst32 + width * row),
+                              _mm256_permutevar8x32_epi32(colors, indices));
+        }
+      }
+    }
+  }
+}
+
 void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
                             const u8* tlut, TLUTFormat tlutfmt)
 {
@@ -1422,7 +1716,9 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
   switch (texformat)
   {
   case TextureFormat::C4:
-    TexDecoder_DecodeImpl_C4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (!cpu_info.bAVX2 || !TexDecoder_DecodeImpl_C4_AVX2(dst, src, width, height, texformat, tlut,
+                                                          tlutfmt, Wsteps4, Wsteps8))
+      TexDecoder_DecodeImpl_C4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::I4:
@@ -1442,7 +1738,9 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::C8:
-    TexDecoder_DecodeImpl_C8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (!cpu_info.bAVX2 || !TexDecoder_DecodeImpl_C8_AVX2(dst, src, width, height, texformat, tlut,
+                                                          tlutfmt, Wsteps4, Wsteps8))
+      TexDecoder_DecodeImpl_C8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::IA4:
@@ -1450,7 +1748,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::IA8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_IA8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                     Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_IA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                       Wsteps8);
     else
@@ -1459,8 +1760,12 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::C14X2:
-    TexDecoder_DecodeImpl_C14X2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                Wsteps8);
+    // Decoding the palette up front only pays off for textures that are large compared to it.
+    if (width * height < 16384 || !cpu_info.bAVX2 ||
+        !TexDecoder_DecodeImpl_C14X2_AVX2(dst, src, width, height, texformat, tlut, tlutfmt,
+                                          Wsteps4, Wsteps8))
+      TexDecoder_DecodeImpl_C14X2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                  Wsteps8);
     break;
 
   case TextureFormat::RGB565:
@@ -1469,7 +1774,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::RGB5A3:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGB5A3_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                        Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_RGB5A3_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                          Wsteps8);
     else
@@ -1487,7 +1795,12 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::CMPR:
-    TexDecoder_DecodeImpl_CMPR(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_CMPR_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                      Wsteps8);
+    else
+      TexDecoder_DecodeImpl_CMPR(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                 Wsteps8);
     break;
 
   case TextureFormat::XFB:
@@ -28,9 +28,28 @@ public:
     vid[4] = vat.g2.Hex;
     hash = CalculateHash();
   }
+  explicit VertexLoaderUID(const std::array<u32, 5>& data) : vid{data}, hash{CalculateHash()} {}
 
   bool operator==(const VertexLoaderUID& rh) const { return vid == rh.vid; }
   size_t GetHash() const { return hash; }
+  const std::array<u32, 5>& GetData() const { return vid; }
+
+  TVtxDesc GetVtxDesc() const
+  {
+    TVtxDesc vtx_desc;
+    vtx_desc.low.Hex = vid[0];
+    vtx_desc.high.Hex = vid[1];
+    return vtx_desc;
+  }
+
+  VAT GetVAT() const
+  {
+    VAT vat;
+    vat.g0.Hex = vid[2];
+    vat.g1.Hex = vid[3];
+    vat.g2.Hex = vid[4];
+    return vat;
+  }
 
 private:
   size_t CalculateHash() const
@@ -69,7 +88,9 @@ public:
 
   // used by VertexLoaderManager
   NativeVertexFormat* m_native_vertex_format = nullptr;
-  int m_numLoadedVertices = 0;
+  u64 m_numLoadedVertices = 0;
+  // Only accumulated while the statistics overlay is shown
+  DT m_load_time{};
 
 protected:
   VertexLoaderBase(const TVtxDesc& vtx_desc, const VAT& vtx_attr)
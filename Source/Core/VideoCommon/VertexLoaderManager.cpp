@@ -13,10 +13,15 @@
 #include <utility>
 #include <vector>
 
+#include "Common/CommonPaths.h"
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
+#include "Common/WorkQueueThread.h"
 
+#include "Core/ConfigManager.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
@@ -53,6 +58,16 @@ static std::mutex s_vertex_loader_map_lock;
 static VertexLoaderMap s_vertex_loader_map;
 // TODO - change into array of pointers. Keep a map of all seen so far.
 
+// Every UID that ends up in s_vertex_loader_map is appended to this file, which is read back on
+// the next boot of the same game. Protected by s_vertex_loader_map_lock.
+static File::IOFile s_uid_cache_file;
+static Common::WorkQueueThread<VertexLoaderUID> s_precompile_thread;
+
+constexpr u32 UID_CACHE_MAGIC = 0x4449554C;  // LUID
+constexpr u32 UID_CACHE_VERSION = 1;
+constexpr size_t UID_CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
+using SerializedVertexLoaderUID = std::array<u32, 5>;
+
 Common::EnumMap<u8*, CPArray::TexCoord7> cached_arraybases;
 
 BitSet8 g_main_vat_dirty;
@@ -72,11 +87,124 @@ void Init()
 
 void Clear()
 {
+  s_precompile_thread.StopAndCancel();
+
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  s_uid_cache_file.Close();
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
 }
 
+// Must be called with s_vertex_loader_map_lock held.
+static void AppendUID(const VertexLoaderUID& uid)
+{
+  if (!s_uid_cache_file.IsOpen())
+    return;
+
+  const SerializedVertexLoaderUID& data = uid.GetData();
+  if (!s_uid_cache_file.WriteBytes(data.data(), sizeof(data)))
+  {
+    WARN_LOG_FMT(VIDEO, "Writing vertex loader UID to cache failed, closing file.");
+    s_uid_cache_file.Close();
+  }
+}
+
+static void PrecompileLoader(const VertexLoaderUID& uid)
+{
+  {
+    std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+    if (s_vertex_loader_map.contains(uid))
+      return;
+  }
+
+  // Generate the code without holding the lock, so that the GPU thread is not blocked on us.
+  // The native vertex format is created later on the GPU thread, as for preprocessing.
+  std::unique_ptr<VertexLoaderBase> loader =
+      VertexLoaderBase::CreateVertexLoader(uid.GetVtxDesc(), uid.GetVAT());
+
+  std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  if (s_vertex_loader_map.try_emplace(uid, std::move(loader)).second)
+  {
+    INCSTAT(g_stats.num_vertex_loaders);
+    INCSTAT(g_stats.num_vertex_loaders_precompiled);
+  }
+}
+
+void LoadUIDCache()
+{
+  if (!g_ActiveConfig.bShaderCache)
+    return;
+
+  const std::string filename =
+      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".vtxuidcache";
+
+  std::vector<VertexLoaderUID> uids;
+  std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  if (s_uid_cache_file.Open(filename, "rb+"))
+  {
+    u32 existing_magic;
+    u32 existing_version;
+    bool uid_file_valid = false;
+    if (s_uid_cache_file.ReadBytes(&existing_magic, sizeof(existing_magic)) &&
+        s_uid_cache_file.ReadBytes(&existing_version, sizeof(existing_version)) &&
+        existing_magic == UID_CACHE_MAGIC && existing_version == UID_CACHE_VERSION)
+    {
+      // A truncated trailing entry means the file was not written completely, so don't trust it.
+      const u64 file_size = s_uid_cache_file.GetSize();
+      const size_t uid_count = static_cast<size_t>(file_size - UID_CACHE_HEADER_SIZE) /
+                               sizeof(SerializedVertexLoaderUID);
+      const size_t expected_size =
+          uid_count * sizeof(SerializedVertexLoaderUID) + UID_CACHE_HEADER_SIZE;
+      uid_file_valid = file_size == expected_size;
+      for (size_t i = 0; uid_file_valid && i < uid_count; i++)
+      {
+        SerializedVertexLoaderUID data;
+        uid_file_valid = s_uid_cache_file.ReadBytes(data.data(), sizeof(data));
+        if (uid_file_valid)
+          uids.emplace_back(data);
+      }
+
+      // We open the file for reading and writing, so we must seek to the end before writing.
+      if (uid_file_valid)
+        uid_file_valid = s_uid_cache_file.Seek(expected_size, File::SeekOrigin::Begin);
+    }
+
+    if (!uid_file_valid)
+    {
+      uids.clear();
+      s_uid_cache_file.Close();
+    }
+  }
+
+  if (!s_uid_cache_file.IsOpen() && s_uid_cache_file.Open(filename, "wb"))
+  {
+    s_uid_cache_file.WriteBytes(&UID_CACHE_MAGIC, sizeof(UID_CACHE_MAGIC));
+    s_uid_cache_file.WriteBytes(&UID_CACHE_VERSION, sizeof(UID_CACHE_VERSION));
+
+    // Keep loaders which were created before the cache was opened.
+    for (const auto& it : s_vertex_loader_map)
+      AppendUID(it.first);
+  }
+
+  INFO_LOG_FMT(VIDEO, "Read {} vertex loader UIDs from {}", uids.size(), filename);
+  if (uids.empty())
+    return;
+
+  for (const VertexLoaderUID& uid : uids)
+    s_precompile_thread.Push(uid);
+  s_precompile_thread.Reset("Vertex Loader Precompiler", PrecompileLoader);
+}
+
+std::vector<LoaderStatistics> GetLoaderStatistics()
+{
+  std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  std::vector<LoaderStatistics> result;
+  result.reserve(s_vertex_loader_map.size());
+  for (const auto& [uid, loader] : s_vertex_loader_map)
+    result.push_back({uid, loader->m_numLoadedVertices, loader->m_load_time});
+  return result;
+}
+
 void UpdateVertexArrayPointers()
 {
   // Anything to update?
@@ -236,6 +364,7 @@ VertexLoaderBase* GetOrCreateLoader(int vtx_attr_group)
         VertexLoaderBase::CreateVertexLoader(state->vtx_desc, state->vtx_attr[vtx_attr_group]));
     loader = it->second.get();
     INCSTAT(g_stats.num_vertex_loaders);
+    AppendUID(uid);
   }
   if (check_for_native_format)
   {
@@ -441,6 +570,7 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
                           primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES);
 
     const int stride = loader->m_native_vtx_decl.stride;
+    const bool collect_loader_stats = g_ActiveConfig.bOverlayStats;
     do
     {
       const int max_vertices = 16380;  // Max is 16383, but 16380 is divisible by both 4 and 3
@@ -449,7 +579,10 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
       DataReader dst = g_vertex_manager->PrepareForAdditionalData(primitive, run, stride,
                                                                   cullall || can_cpu_cull);
 
+      const auto start_time = collect_loader_stats ? Clock::now() : Clock::time_point{};
       const int num_loaded = loader->RunVertices(src, dst.GetPointer(), run);
+      if (collect_loader_stats)
+        loader->m_load_time += Clock::now() - start_time;
       src += loader->m_vertex_size * max_vertices;
 
       if (can_cpu_cull && !cullall)
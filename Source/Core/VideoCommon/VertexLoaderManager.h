@@ -7,10 +7,12 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
 #include "VideoCommon/CPMemory.h"
+#include "VideoCommon/VertexLoaderBase.h"
 
 class NativeVertexFormat;
 struct PortableVertexDeclaration;
@@ -28,6 +30,20 @@ using NativeVertexFormatMap =
 void Init();
 void Clear();
 
+// Reads the per-game vertex loader UID cache, and compiles the loaders it lists on a worker
+// thread so that the first draw with a previously seen vertex format doesn't stall.
+void LoadUIDCache();
+
+struct LoaderStatistics
+{
+  VertexLoaderUID uid;
+  u64 num_vertices;
+  DT load_time;
+};
+
+// Returns a snapshot of the counters of all vertex loaders created so far.
+std::vector<LoaderStatistics> GetLoaderStatistics();
+
 void MarkAllDirty();
 
 // Creates or obtains a pointer to a VertexFormat representing decl.
@@ -341,6 +341,7 @@ bool VideoBackendBase::InitializeShared(std::unique_ptr<AbstractGfx> gfx,
   }
 
   g_shader_cache->InitializeShaderCache();
+  VertexLoaderManager::LoadUIDCache();
 
   return true;
 }
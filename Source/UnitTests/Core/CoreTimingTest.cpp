@@ -3,10 +3,17 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
 #include <bitset>
+#include <chrono>
+#include <map>
+#include <random>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "Common/ChunkFile.h"
 #include "Common/Config/Config.h"
 #include "Common/FileUtil.h"
 #include "Core/Config/MainSettings.h"
@@ -401,3 +408,274 @@ TEST(CoreTiming, Overclocking)
   Config::SetCurrent(Config::MAIN_OVERCLOCK, 1.0f);
   AdvanceAndCheck(system, 4, MAX_SLICE_LENGTH);
 }
+
+namespace EventOrderTest
+{
+static std::vector<u64> s_order;
+
+static void RecordCallback(Core::System& system, const u64 userdata, const s64 lateness)
+{
+  s_order.push_back(userdata);
+}
+
+struct ScheduledEvent
+{
+  s64 time;
+  u64 id;
+};
+
+static std::vector<u64> RunEvents(Core::System& system, size_t count)
+{
+  s_order.clear();
+  auto& core_timing = system.GetCoreTiming();
+  auto& ppc_state = system.GetPPCState();
+  // Every event is scheduled less than 10000000 cycles ahead.
+  for (int i = 0; i < 10000000 / MAX_SLICE_LENGTH + 1 && s_order.size() < count; ++i)
+  {
+    ppc_state.downcount = 0;
+    core_timing.Advance();
+  }
+  return s_order;
+}
+}  // namespace EventOrderTest
+
+// Mixes events that land in the timing wheel with ones far enough ahead to be kept separately,
+// and checks that they still run in (time, scheduling order) order.
+TEST(CoreTiming, NearAndFarEventOrder)
+{
+  using namespace EventOrderTest;
+
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  auto& core_timing = system.GetCoreTiming();
+  CoreTiming::EventType* cb = core_timing.RegisterEvent("callbackRecord", RecordCallback);
+  CoreTiming::EventType* cb_removed = core_timing.RegisterEvent("callbackRemoved", RecordCallback);
+
+  // Enter slice 0
+  core_timing.Advance();
+
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> kind_dist(0, 9);
+  std::vector<ScheduledEvent> expected;
+  for (u64 id = 0; id < 2000; ++id)
+  {
+    const int kind = kind_dist(rng);
+    const s64 cycles = kind < 7 ? rng() % 5000 : kind < 9 ? rng() % 10000000 : 1000;
+    if (id % 10 == 5)
+    {
+      core_timing.ScheduleEvent(cycles, cb_removed, UINT64_MAX);
+      continue;
+    }
+    core_timing.ScheduleEvent(cycles, cb, id);
+    expected.push_back({cycles, id});
+  }
+  core_timing.RemoveEvent(cb_removed);
+
+  std::ranges::stable_sort(expected, {}, &ScheduledEvent::time);
+  std::vector<u64> expected_order;
+  for (const ScheduledEvent& event : expected)
+    expected_order.push_back(event.id);
+
+  EXPECT_EQ(expected_order, RunEvents(system, expected_order.size() + 1));
+}
+
+TEST(CoreTiming, SaveStateKeepsEventOrder)
+{
+  using namespace EventOrderTest;
+
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  auto& core_timing = system.GetCoreTiming();
+  CoreTiming::EventType* cb = core_timing.RegisterEvent("callbackRecord", RecordCallback);
+
+  // Enter slice 0
+  core_timing.Advance();
+
+  std::mt19937 rng(7);
+  for (u64 id = 0; id < 500; ++id)
+    core_timing.ScheduleEvent(rng() % 4 == 0 ? rng() % 5000000 : rng() % 3000, cb, id);
+
+  const auto do_state = [&](std::vector<u8>* buffer, PointerWrap::Mode mode) {
+    u8* ptr = buffer->data();
+    PointerWrap p(&ptr, buffer->size(), mode);
+    core_timing.DoState(p);
+    return static_cast<size_t>(ptr - buffer->data());
+  };
+
+  std::vector<u8> state(1);
+  state.resize(do_state(&state, PointerWrap::Mode::Measure));
+  do_state(&state, PointerWrap::Mode::Write);
+
+  const std::vector<u64> first_run = RunEvents(system, 500);
+  ASSERT_EQ(first_run.size(), 500u);
+
+  do_state(&state, PointerWrap::Mode::Read);
+  EXPECT_EQ(first_run, RunEvents(system, 500));
+
+  // Saving again after loading must produce the same data.
+  do_state(&state, PointerWrap::Mode::Read);
+  std::vector<u8> state_again(state.size());
+  do_state(&state_again, PointerWrap::Mode::Write);
+  EXPECT_EQ(state, state_again);
+}
+
+namespace EventMix
+{
+struct PeriodicEvent
+{
+  const char* name;
+  s64 period;
+  CoreTiming::EventType* type = nullptr;
+};
+
+// Roughly the events a GameCube game keeps rescheduling, with typical periods in cycles.
+static std::array<PeriodicEvent, 7> s_periodic_events{{
+    {"AICallback", 16200},
+    {"AudioDMACallback", 2700},
+    {"DSPCallback", 810},
+    {"VICallback", 15400},
+    {"GPUSleeper", 2400},
+    {"IPC_HLE_UpdateCallback", 40500},
+    {"DecCallback", 230000},
+}};
+static CoreTiming::EventType* s_transfer_type = nullptr;
+static CoreTiming::EventType* s_exi_type = nullptr;
+static u64 s_num_callbacks = 0;
+
+// When verifying, every scheduled event is also added to this reference queue. Events with the
+// same time stay in the order they were added, which is the order CoreTiming runs them in.
+static bool s_verify = false;
+static std::multimap<s64, std::pair<CoreTiming::EventType*, u64>> s_expected_events;
+
+static void Schedule(CoreTiming::CoreTimingManager& core_timing, s64 cycles_into_future,
+                     CoreTiming::EventType* type, u64 userdata = 0)
+{
+  if (s_verify)
+  {
+    s_expected_events.emplace(static_cast<s64>(core_timing.GetTicks()) + cycles_into_future,
+                              std::pair(type, userdata));
+  }
+  core_timing.ScheduleEvent(cycles_into_future, type, userdata);
+}
+
+static void CheckCallback(Core::System& system, CoreTiming::EventType* type, u64 userdata,
+                          s64 lateness)
+{
+  ++s_num_callbacks;
+  if (!s_verify)
+    return;
+
+  ASSERT_FALSE(s_expected_events.empty());
+  const auto expected = s_expected_events.begin();
+  EXPECT_EQ(static_cast<s64>(system.GetCoreTiming().GetTicks()) - lateness, expected->first);
+  EXPECT_EQ(std::pair(type, userdata), expected->second);
+  s_expected_events.erase(expected);
+}
+
+static void PeriodicCallback(Core::System& system, const u64 userdata, const s64 lateness)
+{
+  const PeriodicEvent& event = s_periodic_events[userdata];
+  CheckCallback(system, event.type, userdata, lateness);
+  Schedule(system.GetCoreTiming(), event.period - lateness, event.type, userdata);
+}
+
+static void TransferCallback(Core::System& system, const u64 userdata, const s64 lateness)
+{
+  CheckCallback(system, s_transfer_type, userdata, lateness);
+}
+
+static void EXICallback(Core::System& system, const u64 userdata, const s64 lateness)
+{
+  CheckCallback(system, s_exi_type, userdata, lateness);
+}
+
+// Runs a typical event mix: periodic events rescheduling themselves, short EXI-style updates,
+// and DVD-style transfers that are scheduled far ahead and often cancelled.
+static void Run(Core::System& system, s64 emulated_cycles)
+{
+  auto& core_timing = system.GetCoreTiming();
+  auto& ppc_state = system.GetPPCState();
+
+  for (PeriodicEvent& event : s_periodic_events)
+    event.type = core_timing.RegisterEvent(event.name, PeriodicCallback);
+  s_transfer_type = core_timing.RegisterEvent("FinishExecutingCommand", TransferCallback);
+  s_exi_type = core_timing.RegisterEvent("EXIUpdateInterrupts", EXICallback);
+  s_num_callbacks = 0;
+  s_expected_events.clear();
+
+  // Enter slice 0
+  core_timing.Advance();
+  for (u64 i = 0; i < s_periodic_events.size(); ++i)
+    Schedule(core_timing, s_periodic_events[i].period, s_periodic_events[i].type, i);
+
+  std::mt19937 rng(1);
+  s64 emulated = 0;
+  u64 num_slices = 0;
+  while (emulated < emulated_cycles)
+  {
+    // Pretend the CPU ran the whole slice, or was interrupted early by an exception check.
+    const int executed = num_slices % 5 == 0 ? ppc_state.downcount / 2 : ppc_state.downcount;
+    ppc_state.downcount -= executed;
+    emulated += executed;
+    core_timing.Advance();
+    ++num_slices;
+
+    // Everything that was due has run
+    if (s_verify && !s_expected_events.empty())
+      ASSERT_GT(s_expected_events.begin()->first, static_cast<s64>(core_timing.GetTicks()));
+
+    if (num_slices % 64 == 0)
+      Schedule(core_timing, 500000 + rng() % 5000000, s_transfer_type);
+    if (num_slices % 256 == 0)
+    {
+      core_timing.RemoveEvent(s_transfer_type);
+      std::erase_if(s_expected_events,
+                    [](const auto& event) { return event.second.first == s_transfer_type; });
+    }
+    if (num_slices % 16 == 0)
+      Schedule(core_timing, rng() % 20000, s_exi_type);
+  }
+}
+}  // namespace EventMix
+
+// Replays an event mix against a reference queue, to check that every event runs at its time
+// and in the order it was scheduled in.
+TEST(CoreTiming, EventMixReplay)
+{
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  constexpr s64 EMULATED_CYCLES = 10000000;
+  EventMix::s_verify = true;
+  EventMix::Run(system, EMULATED_CYCLES);
+  EventMix::s_verify = false;
+
+  EXPECT_GT(EventMix::s_num_callbacks, static_cast<u64>(EMULATED_CYCLES / 2700));
+}
+
+// Runs an emulated second of the event mix and reports the time spent in CoreTiming as a test
+// property. Run it with --gtest_also_run_disabled_tests.
+TEST(CoreTiming, DISABLED_EventMixBenchmark)
+{
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  const auto start = std::chrono::steady_clock::now();
+  EventMix::Run(system, 486000000);
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  RecordProperty("num_callbacks", static_cast<int>(EventMix::s_num_callbacks));
+  RecordProperty("time_us",
+                 static_cast<int>(
+                     std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()));
+}
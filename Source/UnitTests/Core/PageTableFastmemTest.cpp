@@ -0,0 +1,163 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/BreakPoints.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+#include "UICommon/UICommon.h"
+
+namespace
+{
+constexpr u32 PAGE_TABLE_ADDRESS = 0x00100000;
+constexpr u32 PHYSICAL_ADDRESS = 0x00200000;
+constexpr u32 EFFECTIVE_ADDRESS = 0x00004000;
+constexpr u32 VSID = 0x123;
+
+class PageTableFastmemTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_profile_path = File::CreateTempDir();
+    if (m_profile_path.empty())
+      GTEST_SKIP() << "Unable to create a user directory.";
+
+    Core::DeclareAsCPUThread();
+    UICommon::SetUserDirectory(m_profile_path);
+    Config::Init();
+    SConfig::Init();
+    Config::SetCurrent(Config::MAIN_FASTMEM_PAGE_TABLE, true);
+
+    m_memory.Init();
+    if (!m_memory.InitFastmemArena() || !m_memory.IsPageTableMappingEnabled())
+      GTEST_SKIP() << "Page table fastmem mappings are not supported on this host.";
+    m_mmu.DBATUpdated();
+
+    // A page table with a single PTEG, containing one PTE which maps EFFECTIVE_ADDRESS (segment 0)
+    // to PHYSICAL_ADDRESS.
+    auto& ppc_state = m_system.GetPPCState();
+    ppc_state.pagetable_base = PAGE_TABLE_ADDRESS;
+    ppc_state.pagetable_hashmask = 0;
+    ppc_state.sr[0] = VSID;
+    ppc_state.msr.DR = 1;
+
+    UPTE_Lo pte1;
+    pte1.V = 1;
+    pte1.VSID = VSID;
+    pte1.API = (EFFECTIVE_ADDRESS >> 22) & 0x3f;
+    UPTE_Hi pte2;
+    pte2.RPN = PHYSICAL_ADDRESS >> PowerPC::HW_PAGE_INDEX_SHIFT;
+    pte2.PP = 2;
+    m_memory.Write_U32(pte1.Hex, PAGE_TABLE_ADDRESS);
+    m_memory.Write_U32(pte2.Hex, PAGE_TABLE_ADDRESS + 4);
+  }
+
+  void TearDown() override
+  {
+    if (m_profile_path.empty())
+      return;
+
+    auto& ppc_state = m_system.GetPPCState();
+    m_system.GetPowerPC().GetMemChecks().Clear();
+    m_mmu.InvalidateTLBEntry(EFFECTIVE_ADDRESS);
+    ppc_state.msr.DR = 0;
+    ppc_state.sr[0] = 0;
+    if (m_memory.IsInitialized())
+      m_memory.Shutdown();
+
+    SConfig::Shutdown();
+    Config::Shutdown();
+    Core::UndeclareAsCPUThread();
+    File::DeleteDirRecursively(m_profile_path);
+  }
+
+  UPTE_Hi GetPTE2() const { return UPTE_Hi{m_memory.Read_U32(PAGE_TABLE_ADDRESS + 4)}; }
+  u8* GetLogicalPointer() const { return m_memory.GetLogicalBase() + EFFECTIVE_ADDRESS; }
+  u8* GetPhysicalPointer() const { return m_memory.GetRAM() + PHYSICAL_ADDRESS; }
+
+  Core::System& m_system = Core::System::GetInstance();
+  Memory::MemoryManager& m_memory = m_system.GetMemory();
+  PowerPC::MMU& m_mmu = m_system.GetMMU();
+  std::string m_profile_path;
+};
+}  // namespace
+
+TEST_F(PageTableFastmemTest, MapsPagesReadOnlyUntilWritten)
+{
+  GetPhysicalPointer()[0x10] = 0x5a;
+
+  ASSERT_TRUE(m_mmu.HandlePageTableFastmemFault(EFFECTIVE_ADDRESS + 0x10));
+  const Memory::PageTableMapping* mapping = m_memory.GetPageTableMapping(EFFECTIVE_ADDRESS);
+  ASSERT_NE(mapping, nullptr);
+  EXPECT_FALSE(mapping->writeable);
+  EXPECT_EQ(GetLogicalPointer()[0x10], 0x5a);
+  EXPECT_EQ(GetPTE2().R, 1u);
+  EXPECT_EQ(GetPTE2().C, 0u);
+
+  // The first write faults again, sets the C bit and makes the mapping writeable
+  ASSERT_TRUE(m_mmu.HandlePageTableFastmemFault(EFFECTIVE_ADDRESS + 0x10));
+  mapping = m_memory.GetPageTableMapping(EFFECTIVE_ADDRESS);
+  ASSERT_NE(mapping, nullptr);
+  EXPECT_TRUE(mapping->writeable);
+  EXPECT_EQ(GetPTE2().C, 1u);
+
+  GetLogicalPointer()[0x20] = 0xa5;
+  EXPECT_EQ(GetPhysicalPointer()[0x20], 0xa5);
+
+  // Faults on writeable mappings are left to the JIT
+  EXPECT_FALSE(m_mmu.HandlePageTableFastmemFault(EFFECTIVE_ADDRESS + 0x10));
+}
+
+TEST_F(PageTableFastmemTest, UnmapsInvalidatedPages)
+{
+  ASSERT_TRUE(m_mmu.HandlePageTableFastmemFault(EFFECTIVE_ADDRESS));
+  ASSERT_NE(m_memory.GetPageTableMapping(EFFECTIVE_ADDRESS), nullptr);
+
+  m_mmu.InvalidateTLBEntry(EFFECTIVE_ADDRESS);
+  EXPECT_EQ(m_memory.GetPageTableMapping(EFFECTIVE_ADDRESS), nullptr);
+}
+
+TEST_F(PageTableFastmemTest, UnmapsPagesOnSegmentRegisterChange)
+{
+  ASSERT_TRUE(m_mmu.HandlePageTableFastmemFault(EFFECTIVE_ADDRESS));
+  ASSERT_NE(m_memory.GetPageTableMapping(EFFECTIVE_ADDRESS), nullptr);
+
+  auto& ppc_state = m_system.GetPPCState();
+  ppc_state.sr[0] = VSID + 1;
+  m_mmu.SRUpdated(0);
+  EXPECT_EQ(m_memory.GetPageTableMapping(EFFECTIVE_ADDRESS), nullptr);
+
+  // The TLB entry for the old VSID must not be used for the new segment
+  EXPECT_FALSE(m_mmu.HandlePageTableFastmemFault(EFFECTIVE_ADDRESS));
+  EXPECT_EQ(m_memory.GetPageTableMapping(EFFECTIVE_ADDRESS), nullptr);
+}
+
+TEST_F(PageTableFastmemTest, DoesNotMapPagesWithMemchecks)
+{
+  ASSERT_TRUE(m_mmu.HandlePageTableFastmemFault(EFFECTIVE_ADDRESS));
+  ASSERT_NE(m_memory.GetPageTableMapping(EFFECTIVE_ADDRESS), nullptr);
+
+  TMemCheck memcheck;
+  memcheck.start_address = EFFECTIVE_ADDRESS + 0x100;
+  memcheck.end_address = EFFECTIVE_ADDRESS + 0x103;
+  memcheck.is_break_on_read = true;
+  memcheck.is_break_on_write = true;
+  m_system.GetPowerPC().GetMemChecks().Add(std::move(memcheck));
+  EXPECT_EQ(m_memory.GetPageTableMapping(EFFECTIVE_ADDRESS), nullptr);
+
+  EXPECT_FALSE(m_mmu.HandlePageTableFastmemFault(EFFECTIVE_ADDRESS));
+  EXPECT_EQ(m_memory.GetPageTableMapping(EFFECTIVE_ADDRESS), nullptr);
+}
@@ -0,0 +1,128 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+
+namespace
+{
+std::unique_ptr<JitBlock> MakeBlock(u32 address, u32 num_instructions)
+{
+  auto block = std::make_unique<JitBlock>(false);
+  block->physicalAddress = address;
+  for (u32 i = 0; i < num_instructions; ++i)
+    block->physical_addresses.push_back(address + i * 4);
+  return block;
+}
+
+std::vector<JitBlock*> Overlapping(const BlockRangeMap& map, u32 address, u32 length)
+{
+  std::vector<JitBlock*> blocks;
+  map.GetOverlappingBlocks(address, length, &blocks);
+  std::ranges::sort(blocks);
+  return blocks;
+}
+}  // namespace
+
+TEST(BlockRangeMap, FindsOverlappingBlocks)
+{
+  BlockRangeMap map;
+  const auto a = MakeBlock(0x80, 8);
+  const auto b = MakeBlock(0x1000, 4);
+  map.Add(a.get());
+  map.Add(b.get());
+
+  EXPECT_EQ(Overlapping(map, 0x80, 4), std::vector<JitBlock*>{a.get()});
+  EXPECT_EQ(Overlapping(map, 0x9c, 4), std::vector<JitBlock*>{a.get()});
+  EXPECT_TRUE(Overlapping(map, 0xa0, 0x20).empty());
+  EXPECT_TRUE(Overlapping(map, 0x60, 0x20).empty());
+  EXPECT_EQ(Overlapping(map, 0x100c, 0x100), std::vector<JitBlock*>{b.get()});
+  EXPECT_TRUE(Overlapping(map, 0x1000, 0).empty());
+}
+
+TEST(BlockRangeMap, ReportsBlocksSpanningRangesOnce)
+{
+  BlockRangeMap map;
+  // Crosses a range boundary and a leaf boundary.
+  const auto block = MakeBlock(0xfff80, 0x100);
+  map.Add(block.get());
+
+  EXPECT_EQ(Overlapping(map, 0, 0x200000), std::vector<JitBlock*>{block.get()});
+  EXPECT_EQ(Overlapping(map, 0x100100, 4), std::vector<JitBlock*>{block.get()});
+
+  map.Remove(block.get());
+  EXPECT_TRUE(Overlapping(map, 0, 0x200000).empty());
+}
+
+TEST(BlockRangeMap, RemovesOnlyTheGivenBlock)
+{
+  BlockRangeMap map;
+  const auto a = MakeBlock(0x2000, 4);
+  const auto b = MakeBlock(0x2010, 4);
+  map.Add(a.get());
+  map.Add(b.get());
+
+  map.Remove(a.get());
+  EXPECT_EQ(Overlapping(map, 0x2000, 0x100), std::vector<JitBlock*>{b.get()});
+
+  map.Clear();
+  EXPECT_TRUE(Overlapping(map, 0x2000, 0x100).empty());
+}
+
+TEST(BlockRangeMap, ReplaysInvalidationTrace)
+{
+  // Mimics a game that keeps patching code and DMAing over parts of MEM1: mostly single cache line
+  // invalidations, some page sized ones and a few large ones. Every result is checked against a
+  // linear scan.
+  constexpr u32 MEMORY_SIZE = 0x1800000;
+  constexpr int NUM_EVENTS = 5000;
+
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<u32> address_dist(0, MEMORY_SIZE / 4 - 1);
+  std::uniform_int_distribution<u32> size_dist(1, 64);
+  std::uniform_int_distribution<int> kind_dist(0, 99);
+
+  BlockRangeMap map;
+  std::vector<std::unique_ptr<JitBlock>> live;
+  std::vector<JitBlock*> found;
+
+  for (int event = 0; event < NUM_EVENTS; ++event)
+  {
+    // Keep compiling new blocks so that invalidations have something to erase.
+    for (int i = 0; i < 2; ++i)
+    {
+      live.push_back(MakeBlock(address_dist(rng) * 4, size_dist(rng)));
+      map.Add(live.back().get());
+    }
+
+    const int kind = kind_dist(rng);
+    const u32 length = kind < 90 ? 32 : kind < 99 ? 0x1000 : 0x100000;
+    const u32 address = std::min(address_dist(rng) * 4, MEMORY_SIZE - length) & ~0x1fu;
+
+    found.clear();
+    map.GetOverlappingBlocks(address, length, &found);
+    for (JitBlock* block : found)
+      map.Remove(block);
+
+    std::vector<JitBlock*> expected;
+    for (const auto& block : live)
+    {
+      if (block->OverlapsPhysicalRange(address, length))
+        expected.push_back(block.get());
+    }
+    std::ranges::sort(found);
+    std::ranges::sort(expected);
+    ASSERT_EQ(found, expected);
+
+    std::erase_if(live, [&](const auto& block) {
+      return std::ranges::binary_search(found, block.get());
+    });
+  }
+}
@@ -0,0 +1,195 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/ChunkStoreBlob.h"
+#include "DiscIO/FileBlob.h"
+
+namespace
+{
+constexpr u32 CHUNK_SIZE = 0x8000;
+constexpr int COMPRESSION_LEVEL = 5;
+
+// Alternates between chunks of random data, which are stored uncompressed, and chunks that
+// compress well. The last chunk is only partially filled.
+std::vector<u8> MakeImage(u32 seed, size_t num_chunks)
+{
+  std::mt19937 rng(seed);
+  std::vector<u8> data(num_chunks * CHUNK_SIZE - CHUNK_SIZE / 2);
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = (i / CHUNK_SIZE) % 2 == 0 ? static_cast<u8>(rng()) : static_cast<u8>(i / 64);
+  return data;
+}
+
+std::set<Common::SHA1::Digest> GetChunkHashes(const std::vector<u8>& data)
+{
+  std::set<Common::SHA1::Digest> hashes;
+  for (size_t offset = 0; offset < data.size(); offset += CHUNK_SIZE)
+  {
+    const size_t size = std::min<size_t>(CHUNK_SIZE, data.size() - offset);
+    hashes.insert(Common::SHA1::CalculateDigest(data.data() + offset, size));
+  }
+  return hashes;
+}
+
+class ChunkStoreBlobTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_folder = File::CreateTempDir();
+    if (m_folder.empty())
+      GTEST_SKIP() << "Unable to create a temporary folder.";
+    m_folder += '/';
+  }
+
+  void TearDown() override
+  {
+    if (!m_folder.empty())
+      File::DeleteDirRecursively(m_folder);
+  }
+
+  bool Convert(const std::vector<u8>& data, const std::string& name)
+  {
+    const std::string input_path = m_folder + name + ".iso";
+    if (!File::IOFile(input_path, "wb").WriteBytes(data.data(), data.size()))
+      return false;
+
+    const std::unique_ptr<DiscIO::BlobReader> input =
+        DiscIO::PlainFileReader::Create(File::IOFile(input_path, "rb"));
+    if (!input)
+      return false;
+
+    return DiscIO::ConvertToChunkStore(input.get(), input_path, GetImagePath(name), CHUNK_SIZE,
+                                       COMPRESSION_LEVEL,
+                                       [](const std::string&, float) { return true; });
+  }
+
+  // Returns whether the image could be opened and read completely, and what was read
+  bool ReadImage(const std::string& name, std::vector<u8>* data)
+  {
+    const std::unique_ptr<DiscIO::BlobReader> reader = DiscIO::CreateBlobReader(GetImagePath(name));
+    if (!reader || reader->GetBlobType() != DiscIO::BlobType::CHUNK_STORE)
+      return false;
+
+    data->resize(reader->GetDataSize());
+    return reader->Read(0, data->size(), data->data());
+  }
+
+  std::vector<DiscIO::ChunkStoreEntry> ReadIndex() const
+  {
+    File::IOFile index(m_folder + DiscIO::CHUNK_STORE_INDEX_NAME, "rb");
+    DiscIO::ChunkStoreIndexHeader header;
+    EXPECT_TRUE(index.ReadArray(&header, 1));
+    EXPECT_EQ(header.magic, DiscIO::CHUNK_STORE_INDEX_MAGIC);
+
+    std::vector<DiscIO::ChunkStoreEntry> entries((index.GetSize() - sizeof(header)) /
+                                                 sizeof(DiscIO::ChunkStoreEntry));
+    EXPECT_TRUE(index.ReadArray(entries.data(), entries.size()));
+    return entries;
+  }
+
+  std::string GetImagePath(const std::string& name) const { return m_folder + name + ".dcs"; }
+  std::string GetPackPath() const { return m_folder + DiscIO::CHUNK_STORE_PACK_NAME; }
+
+  std::string m_folder;
+};
+}  // namespace
+
+TEST_F(ChunkStoreBlobTest, RoundTripsImagesAndStoresSharedChunksOnce)
+{
+  // The second image differs from the first in one chunk and has one more chunk
+  const std::vector<u8> image_a = MakeImage(1, 16);
+  std::vector<u8> image_b = MakeImage(1, 17);
+  image_b[3 * CHUNK_SIZE + 5] ^= 0xff;
+
+  ASSERT_TRUE(Convert(image_a, "a"));
+  const u64 pack_size_after_a = File::GetSize(GetPackPath());
+  ASSERT_TRUE(Convert(image_b, "b"));
+
+  std::vector<u8> data;
+  ASSERT_TRUE(ReadImage("a", &data));
+  EXPECT_EQ(data, image_a);
+  ASSERT_TRUE(ReadImage("b", &data));
+  EXPECT_EQ(data, image_b);
+
+  std::set<Common::SHA1::Digest> unique_chunks = GetChunkHashes(image_a);
+  unique_chunks.merge(GetChunkHashes(image_b));
+
+  const std::vector<DiscIO::ChunkStoreEntry> entries = ReadIndex();
+  EXPECT_EQ(entries.size(), unique_chunks.size());
+
+  u64 stored_size = 0;
+  for (const DiscIO::ChunkStoreEntry& entry : entries)
+  {
+    EXPECT_TRUE(unique_chunks.contains(entry.hash));
+    stored_size += entry.stored_size;
+  }
+  EXPECT_EQ(File::GetSize(GetPackPath()), stored_size);
+  EXPECT_LT(File::GetSize(GetPackPath()) - pack_size_after_a, pack_size_after_a);
+}
+
+TEST_F(ChunkStoreBlobTest, RejectsCorruptChunks)
+{
+  const std::vector<u8> image = MakeImage(2, 8);
+  ASSERT_TRUE(Convert(image, "a"));
+
+  // Corrupt a chunk that is stored uncompressed, which only the hash can catch
+  const DiscIO::ChunkStoreEntry entry = ReadIndex()[0];
+  ASSERT_EQ(entry.flags & DiscIO::ChunkStoreEntry::FLAG_COMPRESSED, 0u);
+  {
+    File::IOFile pack(GetPackPath(), "r+b");
+    u8 byte;
+    ASSERT_TRUE(pack.Seek(entry.pack_offset + 100, File::SeekOrigin::Begin));
+    ASSERT_TRUE(pack.ReadBytes(&byte, 1));
+    byte ^= 0xff;
+    ASSERT_TRUE(pack.Seek(entry.pack_offset + 100, File::SeekOrigin::Begin));
+    ASSERT_TRUE(pack.WriteBytes(&byte, 1));
+  }
+
+  std::vector<u8> data;
+  EXPECT_FALSE(ReadImage("a", &data));
+}
+
+TEST_F(ChunkStoreBlobTest, StoresChunksAgainThatAreMissingFromThePack)
+{
+  const std::vector<u8> image = MakeImage(3, 8);
+  ASSERT_TRUE(Convert(image, "a"));
+
+  // Simulate a conversion that wrote the index but not all of the pack
+  {
+    File::IOFile pack(GetPackPath(), "r+b");
+    ASSERT_TRUE(pack.Resize(pack.GetSize() / 2));
+  }
+
+  ASSERT_TRUE(Convert(image, "b"));
+
+  std::vector<u8> data;
+  ASSERT_TRUE(ReadImage("b", &data));
+  EXPECT_EQ(data, image);
+}
+
+TEST_F(ChunkStoreBlobTest, RejectsHeadersWithInconsistentSizes)
+{
+  ASSERT_TRUE(Convert(MakeImage(4, 2), "a"));
+
+  // With a data size this large, rounding it up to whole chunks would overflow to 0 chunks
+  const DiscIO::ChunkStoreHeader header{DiscIO::CHUNK_STORE_MAGIC, DiscIO::CHUNK_STORE_VERSION,
+                                        ~u64(0), CHUNK_SIZE, 0};
+  ASSERT_TRUE(File::IOFile(GetImagePath("b"), "wb").WriteArray(&header, 1));
+
+  EXPECT_EQ(DiscIO::CreateBlobReader(GetImagePath("b")), nullptr);
+}
@@ -0,0 +1,133 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/CompressedBlob.h"
+#include "DiscIO/FileBlob.h"
+
+namespace
+{
+// Small enough for every cache line of the reader to hold several blocks
+constexpr u32 BLOCK_SIZE = 0x4000;
+constexpr u32 NUM_BLOCKS = 20;
+
+// Alternates between blocks of random data, which are stored uncompressed, and blocks that
+// compress well. The last block is only partially filled.
+std::vector<u8> MakeImage()
+{
+  std::mt19937 rng(1);
+  std::vector<u8> data(NUM_BLOCKS * BLOCK_SIZE - BLOCK_SIZE / 2);
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = (i / BLOCK_SIZE) % 2 == 0 ? static_cast<u8>(rng()) : static_cast<u8>(i / 64);
+  return data;
+}
+
+class CompressedBlobTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_folder = File::CreateTempDir();
+    if (m_folder.empty())
+      GTEST_SKIP() << "Unable to create a temporary folder.";
+    m_folder += '/';
+
+    m_image = MakeImage();
+    const std::string input_path = m_folder + "image.iso";
+    ASSERT_TRUE(File::IOFile(input_path, "wb").WriteBytes(m_image.data(), m_image.size()));
+
+    const std::unique_ptr<DiscIO::BlobReader> input =
+        DiscIO::PlainFileReader::Create(File::IOFile(input_path, "rb"));
+    ASSERT_NE(input, nullptr);
+    ASSERT_TRUE(DiscIO::ConvertToGCZ(input.get(), input_path, GetImagePath(), 0, BLOCK_SIZE,
+                                     [](const std::string&, float) { return true; }));
+  }
+
+  void TearDown() override
+  {
+    if (!m_folder.empty())
+      File::DeleteDirRecursively(m_folder);
+  }
+
+  std::unique_ptr<DiscIO::BlobReader> OpenImage() const
+  {
+    std::unique_ptr<DiscIO::BlobReader> reader = DiscIO::CreateBlobReader(GetImagePath());
+    if (!reader || reader->GetBlobType() != DiscIO::BlobType::GCZ)
+      return nullptr;
+    return reader;
+  }
+
+  std::string GetImagePath() const { return m_folder + "image.gcz"; }
+
+  std::string m_folder;
+  std::vector<u8> m_image;
+};
+}  // namespace
+
+TEST_F(CompressedBlobTest, RoundTripsCompressedAndUncompressedBlocks)
+{
+  const std::unique_ptr<DiscIO::BlobReader> reader = OpenImage();
+  ASSERT_NE(reader, nullptr);
+  ASSERT_EQ(reader->GetDataSize(), m_image.size());
+
+  // One read spanning all cache lines, and small reads crossing block boundaries
+  std::vector<u8> data(m_image.size());
+  ASSERT_TRUE(reader->Read(0, data.size(), data.data()));
+  EXPECT_EQ(data, m_image);
+
+  const std::unique_ptr<DiscIO::BlobReader> second_reader = OpenImage();
+  ASSERT_NE(second_reader, nullptr);
+  for (u64 offset = BLOCK_SIZE - 0x10; offset < m_image.size() - 0x20; offset += 5 * BLOCK_SIZE)
+  {
+    std::vector<u8> part(0x20);
+    ASSERT_TRUE(second_reader->Read(offset, part.size(), part.data()));
+    EXPECT_TRUE(std::equal(part.begin(), part.end(), m_image.begin() + offset));
+  }
+
+  const auto& header = static_cast<DiscIO::CompressedBlobReader&>(*reader).GetHeader();
+  EXPECT_LT(header.compressed_data_size, m_image.size());
+}
+
+TEST_F(CompressedBlobTest, ReadsBlocksNextToCorruptBlocks)
+{
+  // Corrupt the second block, which shares a cache line with the blocks around it
+  {
+    File::IOFile file(GetImagePath(), "r+b");
+    DiscIO::CompressedBlobHeader header;
+    ASSERT_TRUE(file.ReadArray(&header, 1));
+    std::vector<u64> block_pointers(header.num_blocks);
+    ASSERT_TRUE(file.ReadArray(block_pointers.data(), block_pointers.size()));
+
+    const u64 data_offset = sizeof(header) + header.num_blocks * (sizeof(u64) + sizeof(u32));
+    const u64 offset = data_offset + (block_pointers[1] & ~(1ULL << 63)) + 4;
+    u8 byte;
+    ASSERT_TRUE(file.Seek(offset, File::SeekOrigin::Begin));
+    ASSERT_TRUE(file.ReadBytes(&byte, 1));
+    byte ^= 0xff;
+    ASSERT_TRUE(file.Seek(offset, File::SeekOrigin::Begin));
+    ASSERT_TRUE(file.WriteBytes(&byte, 1));
+  }
+
+  const std::unique_ptr<DiscIO::BlobReader> reader = OpenImage();
+  ASSERT_NE(reader, nullptr);
+
+  std::vector<u8> data(BLOCK_SIZE);
+  EXPECT_FALSE(reader->Read(BLOCK_SIZE, data.size(), data.data()));
+
+  for (u64 block : {0, 2, 3})
+  {
+    ASSERT_TRUE(reader->Read(block * BLOCK_SIZE, data.size(), data.data()));
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), m_image.begin() + block * BLOCK_SIZE));
+  }
+}
@@ -0,0 +1,145 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "VideoCommon/AsyncShaderCompiler.h"
+
+namespace
+{
+class RecordingWorkItem final : public VideoCommon::AsyncShaderCompiler::WorkItem
+{
+public:
+  RecordingWorkItem(int id_, std::vector<int>* compiled_, std::mutex* compiled_lock_,
+                    std::vector<int>* retrieved_, Common::Event* gate_ = nullptr)
+      : id(id_), compiled(compiled_), compiled_lock(compiled_lock_), retrieved(retrieved_),
+        gate(gate_)
+  {
+  }
+
+  bool Compile() override
+  {
+    if (gate)
+      gate->Wait();
+    std::lock_guard<std::mutex> guard(*compiled_lock);
+    compiled->push_back(id);
+    return true;
+  }
+
+  void Retrieve() override { retrieved->push_back(id); }
+
+private:
+  int id;
+  std::vector<int>* compiled;
+  std::mutex* compiled_lock;
+  std::vector<int>* retrieved;
+  Common::Event* gate;
+};
+
+void RetrieveAll(VideoCommon::AsyncShaderCompiler& compiler)
+{
+  while (compiler.HasPendingWork() || compiler.HasCompletedWork())
+    compiler.RetrieveWorkItems();
+}
+}  // namespace
+
+TEST(AsyncShaderCompiler, CompilesSynchronouslyWithoutWorkers)
+{
+  VideoCommon::AsyncShaderCompiler compiler;
+  std::vector<int> compiled;
+  std::mutex compiled_lock;
+  std::vector<int> retrieved;
+
+  compiler.QueueWorkItem(std::make_unique<RecordingWorkItem>(1, &compiled, &compiled_lock,
+                                                             &retrieved),
+                         0);
+  EXPECT_EQ(compiled, std::vector<int>{1});
+  EXPECT_TRUE(compiler.HasCompletedWork());
+
+  compiler.RetrieveWorkItems();
+  EXPECT_EQ(retrieved, std::vector<int>{1});
+  EXPECT_FALSE(compiler.HasCompletedWork());
+}
+
+TEST(AsyncShaderCompiler, RetrievesEveryItem)
+{
+  VideoCommon::AsyncShaderCompiler compiler;
+  ASSERT_TRUE(compiler.StartWorkerThreads(4));
+
+  std::vector<int> compiled;
+  std::mutex compiled_lock;
+  std::vector<int> retrieved;
+  constexpr int NUM_ITEMS = 1000;
+  for (int i = 0; i < NUM_ITEMS; i++)
+  {
+    compiler.QueueWorkItem(std::make_unique<RecordingWorkItem>(i, &compiled, &compiled_lock,
+                                                               &retrieved),
+                           static_cast<u32>(i % 400));
+  }
+
+  RetrieveAll(compiler);
+  compiler.StopWorkerThreads();
+
+  EXPECT_EQ(compiled.size(), static_cast<size_t>(NUM_ITEMS));
+  EXPECT_EQ(retrieved.size(), static_cast<size_t>(NUM_ITEMS));
+  EXPECT_EQ(compiler.GetQueueStatistics().num_items, static_cast<u64>(NUM_ITEMS));
+}
+
+TEST(AsyncShaderCompiler, CompilesLowerPrioritiesFirst)
+{
+  VideoCommon::AsyncShaderCompiler compiler;
+  ASSERT_TRUE(compiler.StartWorkerThreads(1));
+
+  std::vector<int> compiled;
+  std::mutex compiled_lock;
+  std::vector<int> retrieved;
+
+  // Keep the only worker busy until everything else is queued.
+  Common::Event gate;
+  compiler.QueueWorkItem(
+      std::make_unique<RecordingWorkItem>(0, &compiled, &compiled_lock, &retrieved, &gate), 0);
+  while (compiler.GetQueueStatistics().num_items == 0)
+    std::this_thread::yield();
+
+  compiler.QueueWorkItem(
+      std::make_unique<RecordingWorkItem>(3, &compiled, &compiled_lock, &retrieved), 300);
+  compiler.QueueWorkItem(
+      std::make_unique<RecordingWorkItem>(2, &compiled, &compiled_lock, &retrieved), 200);
+  compiler.QueueWorkItem(
+      std::make_unique<RecordingWorkItem>(1, &compiled, &compiled_lock, &retrieved), 100);
+  gate.Set();
+
+  RetrieveAll(compiler);
+  compiler.StopWorkerThreads();
+
+  EXPECT_EQ(compiled, (std::vector<int>{0, 1, 2, 3}));
+}
+
+TEST(AsyncShaderCompiler, KeepsQueuedWorkAcrossResize)
+{
+  VideoCommon::AsyncShaderCompiler compiler;
+  ASSERT_TRUE(compiler.StartWorkerThreads(2));
+
+  std::vector<int> compiled;
+  std::mutex compiled_lock;
+  std::vector<int> retrieved;
+  constexpr int NUM_ITEMS = 200;
+  for (int i = 0; i < NUM_ITEMS; i++)
+  {
+    compiler.QueueWorkItem(
+        std::make_unique<RecordingWorkItem>(i, &compiled, &compiled_lock, &retrieved), 0);
+  }
+
+  ASSERT_TRUE(compiler.ResizeWorkerThreads(3));
+  RetrieveAll(compiler);
+  compiler.StopWorkerThreads();
+
+  EXPECT_EQ(retrieved.size(), static_cast<size_t>(NUM_ITEMS));
+}